@@ -0,0 +1,205 @@
+#include "dansandu/glyph/dfa_tokenizer.hpp"
+#include "dansandu/ballotin/exception.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/internal/character_skipper.hpp"
+#include "dansandu/glyph/internal/dfa.hpp"
+#include "dansandu/glyph/internal/nfa.hpp"
+#include "dansandu/glyph/internal/text_location.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::error::TokenizationError;
+using dansandu::glyph::internal::dfa::Dfa;
+using dansandu::glyph::internal::dfa::getDfa;
+using dansandu::glyph::internal::dfa::matchLongestPattern;
+using dansandu::glyph::internal::nfa::getNfa;
+using dansandu::glyph::internal::nfa::Nfa;
+using dansandu::glyph::internal::text_location::getTextLocation;
+using dansandu::glyph::symbol::Symbol;
+using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::ITokenStream;
+using dansandu::glyph::tokenizer::TokenizationMode;
+
+namespace dansandu::glyph::dfa_tokenizer
+{
+
+class DfaTokenStream : public ITokenStream
+{
+public:
+    DfaTokenStream(const DfaTokenizer& tokenizer, const std::string_view text)
+        : tokenizer_{tokenizer}, text_{text}, position_{0}
+    {
+    }
+
+    std::optional<Token> nextToken() override
+    {
+        return matchNext(nullptr);
+    }
+
+    std::optional<Token> nextExpectedToken(const std::vector<Symbol>& expectedSymbols) override
+    {
+        if (tokenizer_.mode_ == TokenizationMode::contextFree)
+        {
+            return matchNext(nullptr);
+        }
+        return matchNext(&getAllowedPatterns(expectedSymbols));
+    }
+
+private:
+    // The parser passes the same expected symbols every time it is in a given state, so the masks are cached by the
+    // address of the symbols and only built the first time a state asks for a token.
+    const std::vector<char>& getAllowedPatterns(const std::vector<Symbol>& expectedSymbols)
+    {
+        auto& allowedPatterns = allowedPatterns_[expectedSymbols.data()];
+        if (allowedPatterns.size() != tokenizer_.symbols_.size())
+        {
+            allowedPatterns.resize(tokenizer_.symbols_.size());
+            for (auto pattern = 0U; pattern < allowedPatterns.size(); ++pattern)
+            {
+                allowedPatterns[pattern] = std::binary_search(expectedSymbols.cbegin(), expectedSymbols.cend(),
+                                                              tokenizer_.symbols_[pattern]);
+            }
+        }
+        return allowedPatterns;
+    }
+
+    std::optional<Token> matchNext(const std::vector<char>* const allowedPatterns)
+    {
+        position_ = tokenizer_.skipper_.skip(text_, position_);
+        if (position_ == static_cast<std::int64_t>(text_.size()))
+        {
+            return std::nullopt;
+        }
+        const auto token = tokenizer_.matchToken(text_, position_, allowedPatterns);
+        position_ = token.end();
+        return token;
+    }
+
+    const DfaTokenizer& tokenizer_;
+    std::string_view text_;
+    std::int64_t position_;
+    std::unordered_map<const Symbol*, std::vector<char>> allowedPatterns_;
+};
+
+static Dfa compile(const std::vector<std::pair<Symbol, std::string_view>>& descriptors)
+{
+    auto nfas = std::vector<Nfa>{};
+    nfas.reserve(descriptors.size());
+    for (const auto& descriptor : descriptors)
+    {
+        nfas.push_back(getNfa(descriptor.second));
+    }
+    return getDfa(nfas);
+}
+
+DfaTokenizer::DfaTokenizer(const std::vector<std::pair<Symbol, std::string_view>>& descriptors,
+                           const TokenizationMode mode, const std::string_view skippedCharacters)
+    : dfa_{compile(descriptors)}, mode_{mode}, skipper_{skippedCharacters}
+{
+    symbols_.reserve(descriptors.size());
+    for (const auto& descriptor : descriptors)
+    {
+        symbols_.push_back(descriptor.first);
+    }
+}
+
+// Context aware counterpart of matchLongestPattern, which scans until the automaton gets stuck since any accepted
+// pattern might be the best allowed one.
+static std::pair<int, std::int64_t> matchAllowedPatterns(const Dfa& dfa, const std::string_view text,
+                                                         const std::int64_t position,
+                                                         const std::vector<char>& allowedPatterns)
+{
+    const auto textSize = static_cast<std::int64_t>(text.size());
+    auto state = 0;
+    auto acceptedPattern = -1;
+    auto acceptedEnd = position;
+    for (auto current = position; current < textSize; ++current)
+    {
+        state = dfa.transitions[state * dfa.classesCount + dfa.byteClasses[static_cast<unsigned char>(text[current])]];
+        if (state == -1)
+        {
+            break;
+        }
+        for (const auto pattern : dfa.allAcceptedPatterns[state])
+        {
+            if (allowedPatterns[pattern])
+            {
+                if (acceptedPattern == -1 || pattern <= acceptedPattern)
+                {
+                    acceptedPattern = pattern;
+                    acceptedEnd = current + 1;
+                }
+                break;
+            }
+        }
+    }
+    return {acceptedPattern, acceptedEnd};
+}
+
+std::optional<Token> DfaTokenizer::matchPatterns(const std::string_view text, const std::int64_t position,
+                                                 const std::vector<char>* const allowedPatterns) const
+{
+    const auto [acceptedPattern, acceptedEnd] = allowedPatterns
+                                                    ? matchAllowedPatterns(dfa_, text, position, *allowedPatterns)
+                                                    : matchLongestPattern(dfa_, dfa_.classesCount, text, position);
+    if (acceptedPattern == -1)
+    {
+        return std::nullopt;
+    }
+
+    return Token{symbols_[acceptedPattern], position, acceptedEnd};
+}
+
+Token DfaTokenizer::matchToken(const std::string_view text, const std::int64_t position,
+                               const std::vector<char>* const allowedPatterns) const
+{
+    if (allowedPatterns)
+    {
+        if (const auto token = matchPatterns(text, position, allowedPatterns); token.has_value())
+        {
+            return token.value();
+        }
+    }
+
+    if (const auto token = matchPatterns(text, position, nullptr); token.has_value())
+    {
+        return token.value();
+    }
+
+    const auto textLocation = getTextLocation(text, position, position);
+
+    THROW(TokenizationError, "no pattern matches at line ", textLocation.lineNumber, " and column ",
+          textLocation.columnNumber, "\n", textLocation.highlight);
+}
+
+std::vector<Token> DfaTokenizer::tokenize(const std::string_view text) const
+{
+    auto tokens = std::vector<Token>{};
+    tokenize(text, tokens);
+    return tokens;
+}
+
+void DfaTokenizer::tokenize(const std::string_view text, std::vector<Token>& tokens) const
+{
+    auto position = skipper_.skip(text, 0);
+    while (position != static_cast<std::int64_t>(text.size()))
+    {
+        const auto token = matchToken(text, position, nullptr);
+        tokens.push_back(token);
+        position = skipper_.skip(text, token.end());
+    }
+}
+
+std::unique_ptr<ITokenStream> DfaTokenizer::getTokenStream(const std::string_view text) const
+{
+    return std::make_unique<DfaTokenStream>(*this, text);
+}
+
+}
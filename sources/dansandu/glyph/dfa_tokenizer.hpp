@@ -0,0 +1,56 @@
+#pragma once
+
+#include "dansandu/glyph/internal/character_skipper.hpp"
+#include "dansandu/glyph/internal/dfa.hpp"
+#include "dansandu/glyph/symbol.hpp"
+#include "dansandu/glyph/tokenizer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace dansandu::glyph::dfa_tokenizer
+{
+
+// Compiles all descriptor patterns into a single deterministic automaton and scans each input byte once per token. The
+// first descriptor that matches wins and its token is the longest match of its pattern. This differs from the
+// RegexTokenizer for patterns with alternations since std::regex takes the first alternative that matches, so "<|<="
+// yields "<" there and "<=" here. Empty matches are never turned into tokens. In context aware mode the automaton is
+// scanned until it gets stuck since any accepted pattern might be the best expected one. Token streams remember which
+// patterns each vector of expected symbols allows, so those vectors must not change while a stream is in use, as is
+// the case for the ones the parser passes. Runs of skipped characters, typically whitespace, are jumped over with
+// vectorized scans before each token and never produce tokens, so no token can start with them.
+class PRALINE_EXPORT DfaTokenizer : public dansandu::glyph::tokenizer::ITokenizer
+{
+    friend class DfaTokenStream;
+
+public:
+    explicit DfaTokenizer(
+        const std::vector<std::pair<dansandu::glyph::symbol::Symbol, std::string_view>>& descriptors,
+        const dansandu::glyph::tokenizer::TokenizationMode mode =
+            dansandu::glyph::tokenizer::TokenizationMode::contextFree,
+        const std::string_view skippedCharacters = {});
+
+    std::vector<dansandu::glyph::token::Token> tokenize(const std::string_view text) const override;
+
+    void tokenize(const std::string_view text, std::vector<dansandu::glyph::token::Token>& tokens) const override;
+
+    std::unique_ptr<dansandu::glyph::tokenizer::ITokenStream>
+    getTokenStream(const std::string_view text) const override;
+
+private:
+    std::optional<dansandu::glyph::token::Token> matchPatterns(const std::string_view text, const std::int64_t position,
+                                                               const std::vector<char>* const allowedPatterns) const;
+
+    dansandu::glyph::token::Token matchToken(const std::string_view text, const std::int64_t position,
+                                             const std::vector<char>* const allowedPatterns) const;
+
+    std::vector<dansandu::glyph::symbol::Symbol> symbols_;
+    dansandu::glyph::internal::dfa::Dfa dfa_;
+    dansandu::glyph::tokenizer::TokenizationMode mode_;
+    dansandu::glyph::internal::character_skipper::CharacterSkipper skipper_;
+};
+
+}
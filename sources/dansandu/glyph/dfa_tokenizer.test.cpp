@@ -0,0 +1,196 @@
+#include "dansandu/glyph/dfa_tokenizer.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/regex_tokenizer.hpp"
+#include "dansandu/glyph/token.hpp"
+
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::dfa_tokenizer::DfaTokenizer;
+using dansandu::glyph::error::PatternError;
+using dansandu::glyph::error::TokenizationError;
+using dansandu::glyph::regex_tokenizer::RegexTokenizer;
+using dansandu::glyph::symbol::Symbol;
+using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::TokenizationMode;
+
+TEST_CASE("DfaTokenizer")
+{
+    const auto identifier = Symbol{0};
+    const auto number = Symbol{1};
+    const auto add = Symbol{2};
+    const auto whitespace = Symbol{3};
+
+    const auto tokenizer = DfaTokenizer{
+        {{identifier, "[a-zA-Z]\\w*"}, {number, "([1-9]\\d*|0)(\\.\\d+)?"}, {add, "\\+"}, {whitespace, "\\s+"}}};
+
+    SECTION("empty text")
+    {
+        const auto expected = std::vector<Token>{};
+
+        REQUIRE(tokenizer.tokenize("") == expected);
+    }
+
+    SECTION("good text")
+    {
+        const auto expected =
+            std::vector<Token>{{identifier, 0, 1}, {whitespace, 1, 2}, {add, 2, 3}, {whitespace, 3, 4}, {number, 4, 6}};
+
+        REQUIRE(tokenizer.tokenize("a + 10") == expected);
+    }
+
+    SECTION("bad text")
+    {
+        REQUIRE_THROWS_AS(tokenizer.tokenize("a + & + 20"), TokenizationError);
+
+        REQUIRE_THROWS_AS(tokenizer.tokenize("a + f()"), TokenizationError);
+
+        REQUIRE_THROWS_AS(tokenizer.tokenize("@a + 10"), TokenizationError);
+    }
+
+    SECTION("skipped characters")
+    {
+        const auto skipping =
+            DfaTokenizer{{{identifier, "[a-zA-Z]\\w*"}, {number, "([1-9]\\d*|0)(\\.\\d+)?"}, {add, "\\+"}},
+                         TokenizationMode::contextFree, " \t\n"};
+
+        const auto text = "  a +\n\t                   10 ";
+
+        REQUIRE(skipping.tokenize(text) == std::vector<Token>{{identifier, 2, 3}, {add, 4, 5}, {number, 26, 28}});
+
+        const auto stream = skipping.getTokenStream(text);
+
+        REQUIRE(stream->nextToken() == Token{identifier, 2, 3});
+
+        REQUIRE(stream->nextToken() == Token{add, 4, 5});
+
+        REQUIRE(stream->nextToken() == Token{number, 26, 28});
+
+        REQUIRE(!stream->nextToken().has_value());
+
+        REQUIRE(skipping.tokenize("   ").empty());
+    }
+
+    SECTION("token buffer")
+    {
+        auto tokens = std::vector<Token>{Token{number, 0, 1}};
+
+        tokenizer.tokenize("a + 10", tokens);
+
+        auto expected = std::vector<Token>{Token{number, 0, 1}};
+        const auto produced = tokenizer.tokenize("a + 10");
+        expected.insert(expected.end(), produced.cbegin(), produced.cend());
+
+        REQUIRE(tokens == expected);
+
+        tokens.clear();
+        const auto capacity = tokens.capacity();
+
+        tokenizer.tokenize("b + 20", tokens);
+
+        REQUIRE(tokens.capacity() == capacity);
+
+        REQUIRE(tokens == tokenizer.tokenize("b + 20"));
+    }
+
+    SECTION("token stream is lazy")
+    {
+        const auto stream = tokenizer.getTokenStream("a + &");
+
+        REQUIRE(stream->nextToken() == Token{identifier, 0, 1});
+
+        REQUIRE(stream->nextToken() == Token{whitespace, 1, 2});
+
+        REQUIRE(stream->nextToken() == Token{add, 2, 3});
+
+        REQUIRE(stream->nextToken() == Token{whitespace, 3, 4});
+
+        REQUIRE_THROWS_AS(stream->nextToken(), TokenizationError);
+    }
+
+    SECTION("same tokens as regex tokenizer")
+    {
+        const auto regexTokenizer = RegexTokenizer{
+            {{identifier, "[a-zA-Z]\\w*"}, {number, "([1-9]\\d*|0)(\\.\\d+)?"}, {add, "\\+"}, {whitespace, "\\s+"}}};
+
+        const auto text = "alpha +  3.14+beta2 + 0.5 +\n\tgamma_3 + 100";
+
+        REQUIRE(tokenizer.tokenize(text) == regexTokenizer.tokenize(text));
+    }
+
+    SECTION("first descriptor wins")
+    {
+        const auto keyword = Symbol{4};
+
+        const auto keywordFirst = DfaTokenizer{{{keyword, "select"}, {identifier, "[a-z]+"}, {whitespace, " +"}}};
+
+        REQUIRE(keywordFirst.tokenize("select selection") == std::vector<Token>{{keyword, 0, 6},
+                                                                                {whitespace, 6, 7},
+                                                                                {keyword, 7, 13},
+                                                                                {identifier, 13, 16}});
+
+        const auto identifierFirst = DfaTokenizer{{{identifier, "[a-z]+"}, {keyword, "select"}, {whitespace, " +"}}};
+
+        REQUIRE(identifierFirst.tokenize("select selection") ==
+                std::vector<Token>{{identifier, 0, 6}, {whitespace, 6, 7}, {identifier, 7, 16}});
+    }
+
+    SECTION("longest match of the winning descriptor")
+    {
+        const auto dots = DfaTokenizer{{{add, "\\.\\.\\."}, {number, "\\.+"}}};
+
+        REQUIRE(dots.tokenize(".....") == std::vector<Token>{{add, 0, 3}, {number, 3, 5}});
+
+        REQUIRE(dots.tokenize("..") == std::vector<Token>{{number, 0, 2}});
+    }
+
+    SECTION("longest match across alternatives")
+    {
+        const auto less = Symbol{4};
+
+        const auto descriptors = std::vector<std::pair<Symbol, std::string_view>>{{less, "<|<="}, {identifier, "a|ab"}};
+
+        REQUIRE(DfaTokenizer{descriptors}.tokenize("<=ab") == std::vector<Token>{{less, 0, 2}, {identifier, 2, 4}});
+
+        REQUIRE_THROWS_AS(RegexTokenizer{descriptors}.tokenize("<=ab"), TokenizationError);
+
+        const auto longestFirst =
+            std::vector<std::pair<Symbol, std::string_view>>{{less, "<=|<"}, {identifier, "ab|a"}};
+
+        REQUIRE(DfaTokenizer{longestFirst}.tokenize("<=ab") == RegexTokenizer{longestFirst}.tokenize("<=ab"));
+    }
+
+    SECTION("context aware stream")
+    {
+        const auto keyword = Symbol{4};
+
+        const auto contextAware = DfaTokenizer{{{keyword, "select"}, {identifier, "[a-z]+"}, {whitespace, " +"}},
+                                               TokenizationMode::contextAware};
+
+        const auto keywordExpected = std::vector<Symbol>{whitespace, keyword};
+        const auto identifierExpected = std::vector<Symbol>{identifier, whitespace};
+
+        const auto stream = contextAware.getTokenStream("select select select");
+
+        REQUIRE(stream->nextExpectedToken(keywordExpected) == Token{keyword, 0, 6});
+
+        REQUIRE(stream->nextExpectedToken(keywordExpected) == Token{whitespace, 6, 7});
+
+        REQUIRE(stream->nextExpectedToken(identifierExpected) == Token{identifier, 7, 13});
+
+        REQUIRE(stream->nextExpectedToken(identifierExpected) == Token{whitespace, 13, 14});
+
+        REQUIRE(stream->nextExpectedToken(keywordExpected) == Token{keyword, 14, 20});
+    }
+
+    SECTION("unsupported patterns")
+    {
+        REQUIRE_THROWS_AS((DfaTokenizer{{{identifier, "^a"}}}), PatternError);
+
+        REQUIRE_THROWS_AS((DfaTokenizer{{{identifier, "(a)\\1"}}}), PatternError);
+
+        REQUIRE_THROWS_AS((DfaTokenizer{{{identifier, "a(?=b)"}}}), PatternError);
+    }
+}
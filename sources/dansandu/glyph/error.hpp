@@ -2,6 +2,7 @@
 
 #include "dansandu/glyph/symbol.hpp"
 
+#include <cstdint>
 #include <exception>
 #include <string>
 #include <vector>
@@ -25,6 +26,22 @@ private:
     std::string message_;
 };
 
+class PatternError : public std::exception
+{
+public:
+    explicit PatternError(std::string message) : message_{std::move(message)}
+    {
+    }
+
+    const char* what() const noexcept override
+    {
+        return message_.c_str();
+    }
+
+private:
+    std::string message_;
+};
+
 class TokenizationError : public std::exception
 {
 public:
@@ -44,7 +61,7 @@ private:
 class SyntaxError : public std::exception
 {
 public:
-    SyntaxError(std::string message, const int lineNumber, const int columnNumber,
+    SyntaxError(std::string message, const std::int64_t lineNumber, const std::int64_t columnNumber,
                 const dansandu::glyph::symbol::Symbol encounteredSymbol,
                 std::vector<dansandu::glyph::symbol::Symbol> expectedSymbols)
         : message_{std::move(message)},
@@ -60,12 +77,12 @@ public:
         return message_.c_str();
     }
 
-    int getLineNumber() const noexcept
+    std::int64_t getLineNumber() const noexcept
     {
         return lineNumber_;
     }
 
-    int getColumnNumber() const noexcept
+    std::int64_t getColumnNumber() const noexcept
     {
         return columnNumber_;
     }
@@ -82,8 +99,8 @@ public:
 
 private:
     std::string message_;
-    int lineNumber_;
-    int columnNumber_;
+    std::int64_t lineNumber_;
+    std::int64_t columnNumber_;
     dansandu::glyph::symbol::Symbol encounteredSymbol_;
     std::vector<dansandu::glyph::symbol::Symbol> expectedSymbols_;
 };
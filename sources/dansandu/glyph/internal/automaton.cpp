@@ -1,15 +1,33 @@
 #include "dansandu/glyph/internal/automaton.hpp"
-#include "dansandu/ballotin/container.hpp"
 #include "dansandu/ballotin/exception.hpp"
 #include "dansandu/glyph/error.hpp"
 #include "dansandu/glyph/internal/first_table.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
-using dansandu::ballotin::container::contains;
 using dansandu::glyph::error::GrammarError;
 using dansandu::glyph::internal::first_table::getFirstTable;
 using dansandu::glyph::internal::grammar::Grammar;
 using dansandu::glyph::internal::item::Item;
+using dansandu::glyph::internal::item::ItemsHash;
+using dansandu::glyph::internal::item::mergeItems;
 using dansandu::glyph::internal::rule::Rule;
+using dansandu::glyph::internal::symbol_set::hashCombine;
+using dansandu::glyph::internal::symbol_set::hashSeed;
+using dansandu::glyph::internal::symbol_set::SymbolSet;
 using dansandu::glyph::symbol::Symbol;
 
 namespace dansandu::glyph::internal::automaton
@@ -20,65 +38,154 @@ std::ostream& operator<<(std::ostream& stream, const Transition& transition)
     return stream << "Transition(" << transition.symbol << ", " << transition.from << ", " << transition.to << ")";
 }
 
-std::vector<Symbol> getFollowSet(const Item& item, const Grammar& grammar,
-                                 const std::vector<std::vector<Symbol>>& firstTable)
+SymbolSet getFollowSet(const Item& item, const Grammar& grammar, const std::vector<SymbolSet>& firstTable)
 {
-    auto followSet = std::vector<Symbol>{};
-    auto followIndex = item.position + 1;
+    auto followSet = SymbolSet{grammar};
     const auto& rule = grammar.getRules()[item.ruleIndex];
-    while (followIndex < static_cast<int>(rule.rightSide.size()))
+    for (auto followIndex = item.position + 1; followIndex < static_cast<int>(rule.rightSide.size()); ++followIndex)
     {
         const auto& firstSet = firstTable[rule.rightSide[followIndex].getIdentifierIndex()];
-        const auto emptyPosition = std::find(firstSet.cbegin(), firstSet.cend(), grammar.getEmptySymbol());
-        for (auto symbolPosition = firstSet.cbegin(); symbolPosition != firstSet.cend(); ++symbolPosition)
+        followSet |= firstSet;
+        if (!firstSet.contains(grammar.getEmptySymbol()))
         {
-            if (symbolPosition != emptyPosition && !contains(followSet, *symbolPosition))
-            {
-                followSet.push_back(*symbolPosition);
-            }
+            followSet.erase(grammar.getEmptySymbol());
+            return followSet;
         }
-        if (emptyPosition == firstSet.cend())
+    }
+    followSet.erase(grammar.getEmptySymbol());
+    followSet |= item.lookaheads;
+    return followSet;
+}
+
+std::vector<std::vector<ClosureEntry>> getClosureTemplates(const Grammar& grammar,
+                                                           const std::vector<SymbolSet>& firstTable)
+{
+    const auto& rules = grammar.getRules();
+    const auto nonTerminalsCount = grammar.getEndOfStringSymbol().getIdentifierIndex();
+    const auto emptySymbol = grammar.getEmptySymbol();
+
+    // What can follow the first symbol of each rule within the rule.
+    auto restFirstSets = std::vector<SymbolSet>(rules.size(), SymbolSet{grammar});
+    auto restNullable = std::vector<bool>(rules.size(), true);
+    for (auto ruleIndex = 0; ruleIndex < static_cast<int>(rules.size()); ++ruleIndex)
+    {
+        const auto& rightSide = rules[ruleIndex].rightSide;
+        for (auto position = 1; position < static_cast<int>(rightSide.size()) && restNullable[ruleIndex]; ++position)
         {
-            break;
+            const auto& firstSet = firstTable[rightSide[position].getIdentifierIndex()];
+            restFirstSets[ruleIndex] |= firstSet;
+            restNullable[ruleIndex] = firstSet.contains(emptySymbol);
         }
-        ++followIndex;
+        restFirstSets[ruleIndex].erase(emptySymbol);
     }
-    if (followIndex >= static_cast<int>(rule.rightSide.size()))
+
+    auto templates = std::vector<std::vector<ClosureEntry>>(nonTerminalsCount);
+    auto entryIndices = std::vector<int>(nonTerminalsCount, -1);
+    auto worklist = std::vector<int>{};
+    for (auto nonTerminal = 0; nonTerminal < nonTerminalsCount; ++nonTerminal)
     {
-        followSet.push_back(item.lookahead);
+        auto& entries = templates[nonTerminal];
+        entries.push_back({Symbol{nonTerminal}, SymbolSet{grammar}, true});
+        entryIndices[nonTerminal] = 0;
+        worklist.push_back(0);
+        while (!worklist.empty())
+        {
+            const auto entryIndex = worklist.back();
+            worklist.pop_back();
+            const auto parent = entries[entryIndex];
+            for (const auto ruleIndex : grammar.getRuleIndices(parent.nonTerminal))
+            {
+                const auto& rightSide = rules[ruleIndex].rightSide;
+                if (rightSide.empty() || grammar.isTerminal(rightSide.front()))
+                {
+                    continue;
+                }
+                auto lookaheads = restFirstSets[ruleIndex];
+                if (restNullable[ruleIndex])
+                {
+                    lookaheads |= parent.spontaneousLookaheads;
+                }
+                const auto propagates = restNullable[ruleIndex] && parent.propagatesLookaheads;
+                const auto child = rightSide.front().getIdentifierIndex();
+                if (entryIndices[child] == -1)
+                {
+                    entryIndices[child] = static_cast<int>(entries.size());
+                    entries.push_back({rightSide.front(), SymbolSet{grammar}, false});
+                }
+                auto& entry = entries[entryIndices[child]];
+                lookaheads -= entry.spontaneousLookaheads;
+                if (!lookaheads.empty() || (propagates && !entry.propagatesLookaheads))
+                {
+                    entry.spontaneousLookaheads |= lookaheads;
+                    entry.propagatesLookaheads |= propagates;
+                    worklist.push_back(entryIndices[child]);
+                }
+            }
+        }
+        for (const auto& entry : entries)
+        {
+            entryIndices[entry.nonTerminal.getIdentifierIndex()] = -1;
+        }
     }
-    return followSet;
+    return templates;
+}
+
+std::vector<Item> getStateClosure(std::vector<Item> state, const Grammar& grammar,
+                                  const std::vector<SymbolSet>& firstTable)
+{
+    return getStateClosure(std::move(state), grammar, firstTable, getClosureTemplates(grammar, firstTable));
 }
 
 std::vector<Item> getStateClosure(std::vector<Item> state, const Grammar& grammar,
-                                  const std::vector<std::vector<Symbol>>& firstTable)
+                                  const std::vector<SymbolSet>& firstTable,
+                                  const std::vector<std::vector<ClosureEntry>>& closureTemplates)
 {
+    // Every nonterminal pulled in by the state gets one lookahead set shared by all its rules, merged from the
+    // templates of the nonterminals following the dot of the given items.
     const auto& rules = grammar.getRules();
-    for (auto parentItemIndex = 0; parentItemIndex < static_cast<int>(state.size()); ++parentItemIndex)
+    auto lookaheads = std::vector<SymbolSet>(grammar.getEndOfStringSymbol().getIdentifierIndex());
+    auto pulledNonTerminals = std::vector<Symbol>{};
+    const auto itemsCount = static_cast<int>(state.size());
+    for (auto itemIndex = 0; itemIndex < itemsCount; ++itemIndex)
     {
-        const auto parentItem = state[parentItemIndex];
-        const auto parentRule = rules[parentItem.ruleIndex];
-        const auto parentItemFollowSet = getFollowSet(parentItem, grammar, firstTable);
-        if (parentItem.position < static_cast<int>(parentRule.rightSide.size()))
+        const auto& item = state[itemIndex];
+        const auto& rightSide = rules[item.ruleIndex].rightSide;
+        if (item.position == static_cast<int>(rightSide.size()) || grammar.isTerminal(rightSide[item.position]))
+        {
+            continue;
+        }
+        const auto followSet = getFollowSet(item, grammar, firstTable);
+        for (const auto& entry : closureTemplates[rightSide[item.position].getIdentifierIndex()])
         {
-            const auto symbol = parentRule.rightSide[parentItem.position];
-            for (auto ruleIndex = 0; ruleIndex < static_cast<int>(rules.size()); ++ruleIndex)
+            if (!entry.propagatesLookaheads && entry.spontaneousLookaheads.empty())
             {
-                if (symbol == rules[ruleIndex].leftSide)
-                {
-                    for (const auto& followSymbol : parentItemFollowSet)
-                    {
-                        const auto newItem = Item{ruleIndex, 0, followSymbol};
-                        if (!contains(state, newItem))
-                        {
-                            state.push_back(newItem);
-                        }
-                    }
-                }
+                continue;
             }
+            auto& entryLookaheads = lookaheads[entry.nonTerminal.getIdentifierIndex()];
+            if (entryLookaheads.empty())
+            {
+                pulledNonTerminals.push_back(entry.nonTerminal);
+            }
+            entryLookaheads |= entry.spontaneousLookaheads;
+            if (entry.propagatesLookaheads)
+            {
+                entryLookaheads |= followSet;
+            }
+        }
+    }
+    for (const auto nonTerminal : pulledNonTerminals)
+    {
+        const auto& nonTerminalLookaheads = lookaheads[nonTerminal.getIdentifierIndex()];
+        if (nonTerminalLookaheads.empty())
+        {
+            continue;
+        }
+        for (const auto ruleIndex : grammar.getRuleIndices(nonTerminal))
+        {
+            state.push_back(Item{ruleIndex, 0, nonTerminalLookaheads});
         }
     }
-    std::sort(state.begin(), state.end());
+    mergeItems(state);
     return state;
 }
 
@@ -91,11 +198,17 @@ std::map<Symbol, std::vector<Item>> getStateTransitions(const std::vector<Item>&
         if (item.position < static_cast<int>(rules[item.ruleIndex].rightSide.size()))
         {
             const auto symbol = rules[item.ruleIndex].rightSide[item.position];
-            const auto newItem = Item{item.ruleIndex, item.position + 1, item.lookahead};
+            auto newItem = Item{item.ruleIndex, item.position + 1, item.lookaheads};
             auto& toState = transitions[symbol];
-            if (!contains(toState, newItem))
+            const auto sameCore = std::find_if(toState.begin(), toState.end(),
+                                               [&newItem](const Item& other) { return other.hasSameCore(newItem); });
+            if (sameCore == toState.end())
             {
-                toState.push_back(newItem);
+                toState.push_back(std::move(newItem));
+            }
+            else
+            {
+                sameCore->lookaheads |= newItem.lookaheads;
             }
         }
     }
@@ -116,29 +229,45 @@ bool isFinalState(const std::vector<Item>& state, const Grammar& grammar)
     return false;
 }
 
-Automaton getAutomaton(const Grammar& grammar)
+std::vector<Item> getLr0StateClosure(std::vector<Item> state, const Grammar& grammar)
 {
-    const auto startRuleIndex = grammar.getStartRuleIndex();
-    const auto firstTable = getFirstTable(grammar);
-
-    auto finalStateIndex = -1;
-    auto states = std::vector<std::vector<Item>>{
-        getStateClosure({Item{startRuleIndex, 0, grammar.getEndOfStringSymbol()}}, grammar, firstTable)};
-    auto transitions = std::vector<Transition>{};
-    for (auto stateIndex = 0; stateIndex < static_cast<int>(states.size()); ++stateIndex)
+    const auto& rules = grammar.getRules();
+    auto expanded = std::vector<bool>(grammar.getEndOfStringSymbol().getIdentifierIndex());
+    for (auto parentItemIndex = 0; parentItemIndex < static_cast<int>(state.size()); ++parentItemIndex)
     {
-        for (auto& transition : getStateTransitions(states[stateIndex], grammar))
+        const auto& parentRule = rules[state[parentItemIndex].ruleIndex];
+        const auto parentPosition = state[parentItemIndex].position;
+        if (parentPosition < static_cast<int>(parentRule.rightSide.size()))
         {
-            auto newState = getStateClosure(std::move(transition.second), grammar, firstTable);
-            const auto newStatePosition = std::find(states.cbegin(), states.cend(), newState);
-            const auto newStateIndex = static_cast<int>(newStatePosition - states.cbegin());
-            if (newStatePosition == states.cend())
+            const auto symbol = parentRule.rightSide[parentPosition];
+            if (grammar.isTerminal(symbol) || expanded[symbol.getIdentifierIndex()])
+            {
+                continue;
+            }
+            expanded[symbol.getIdentifierIndex()] = true;
+            for (const auto ruleIndex : grammar.getRuleIndices(symbol))
             {
-                states.push_back(std::move(newState));
+                state.push_back(Item{ruleIndex, 0});
             }
-            transitions.push_back({transition.first, stateIndex, newStateIndex});
         }
-        if (isFinalState(states[stateIndex], grammar))
+    }
+    mergeItems(state);
+    return state;
+}
+
+static SymbolSet getStartLookaheads(const Grammar& grammar)
+{
+    auto lookaheads = SymbolSet{grammar};
+    lookaheads.insert(grammar.getEndOfStringSymbol());
+    return lookaheads;
+}
+
+static int getFinalStateIndex(const std::vector<std::vector<Item>>& kernels, const Grammar& grammar)
+{
+    auto finalStateIndex = -1;
+    for (auto stateIndex = 0; stateIndex < static_cast<int>(kernels.size()); ++stateIndex)
+    {
+        if (isFinalState(kernels[stateIndex], grammar))
         {
             if (finalStateIndex == -1)
             {
@@ -154,7 +283,327 @@ Automaton getAutomaton(const Grammar& grammar)
     {
         THROW(GrammarError, "no final state was found");
     }
-    return {std::move(states), std::move(transitions), finalStateIndex};
+    return finalStateIndex;
+}
+
+// Threads created once per automaton build and reused for every breadth first level. The function of a level is run
+// over its indices by the workers and the calling thread, each taking the next index not taken yet, and the call
+// returns once every worker has reached the end of the level.
+class WorkerPool
+{
+public:
+    explicit WorkerPool(const int threadsCount) : end_{0}, generation_{0}, busyWorkers_{0}, stopping_{false}
+    {
+        try
+        {
+            for (auto thread = 1; thread < threadsCount; ++thread)
+            {
+                threads_.emplace_back([this]() { work(); });
+            }
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    ~WorkerPool()
+    {
+        stop();
+    }
+
+    void forEachIndex(const int begin, const int end, std::function<void(int)> function)
+    {
+        {
+            const auto lock = std::lock_guard<std::mutex>{mutex_};
+            function_ = std::move(function);
+            nextIndex_ = begin;
+            end_ = end;
+            busyWorkers_ = static_cast<int>(threads_.size());
+            ++generation_;
+        }
+        levelStarted_.notify_all();
+        runLevel();
+        auto lock = std::unique_lock<std::mutex>{mutex_};
+        levelFinished_.wait(lock, [this]() { return busyWorkers_ == 0; });
+        if (failure_)
+        {
+            std::rethrow_exception(std::exchange(failure_, nullptr));
+        }
+    }
+
+private:
+    void work()
+    {
+        for (auto generation = 0;;)
+        {
+            {
+                auto lock = std::unique_lock<std::mutex>{mutex_};
+                levelStarted_.wait(lock, [this, generation]() { return stopping_ || generation_ != generation; });
+                if (stopping_)
+                {
+                    return;
+                }
+                generation = generation_;
+            }
+            runLevel();
+            const auto lock = std::lock_guard<std::mutex>{mutex_};
+            if (--busyWorkers_ == 0)
+            {
+                levelFinished_.notify_one();
+            }
+        }
+    }
+
+    void runLevel()
+    {
+        try
+        {
+            for (auto index = nextIndex_++; index < end_; index = nextIndex_++)
+            {
+                function_(index);
+            }
+        }
+        catch (...)
+        {
+            nextIndex_ = end_;
+            const auto lock = std::lock_guard<std::mutex>{mutex_};
+            failure_ = failure_ ? failure_ : std::current_exception();
+        }
+    }
+
+    void stop()
+    {
+        {
+            const auto lock = std::lock_guard<std::mutex>{mutex_};
+            stopping_ = true;
+        }
+        levelStarted_.notify_all();
+        for (auto& thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable levelStarted_;
+    std::condition_variable levelFinished_;
+    std::function<void(int)> function_;
+    std::atomic<int> nextIndex_;
+    int end_;
+    int generation_;
+    int busyWorkers_;
+    bool stopping_;
+    std::exception_ptr failure_;
+    std::vector<std::thread> threads_;
+};
+
+template<typename Closure>
+static Automaton buildAutomaton(const Grammar& grammar, const SymbolSet& startLookaheads, const Closure& getClosure,
+                                const int threadsCount)
+{
+    // A state is determined by its kernel, so states are indexed by their sorted kernel and each one is closed only
+    // while its transitions are computed. States are expanded a breadth first level at a time: the transitions of a
+    // level are computed concurrently and then numbered serially in state and symbol order, which is the order a
+    // serial build numbers them in, so the automaton doesn't depend on the number of threads.
+    const auto workersCount =
+        std::max(1, threadsCount > 0 ? threadsCount : static_cast<int>(std::thread::hardware_concurrency()));
+    auto kernels = std::vector<std::vector<Item>>{{Item{grammar.getStartRuleIndex(), 0, startLookaheads}}};
+    auto stateIndices = std::unordered_map<std::vector<Item>, int, ItemsHash>{{kernels.front(), 0}};
+    auto transitions = std::vector<Transition>{};
+    auto levelTransitions = std::vector<std::map<Symbol, std::vector<Item>>>{};
+    auto workers = WorkerPool{workersCount};
+    for (auto levelBegin = 0; levelBegin < static_cast<int>(kernels.size());)
+    {
+        const auto levelEnd = static_cast<int>(kernels.size());
+        levelTransitions.assign(levelEnd - levelBegin, {});
+        workers.forEachIndex(levelBegin, levelEnd,
+                             [&grammar, &getClosure, &kernels, &levelTransitions, levelBegin](const int stateIndex)
+                             {
+                                 auto& stateTransitions = levelTransitions[stateIndex - levelBegin];
+                                 stateTransitions = getStateTransitions(getClosure(kernels[stateIndex]), grammar);
+                                 for (auto& transition : stateTransitions)
+                                 {
+                                     std::sort(transition.second.begin(), transition.second.end());
+                                 }
+                             });
+        for (auto stateIndex = levelBegin; stateIndex < levelEnd; ++stateIndex)
+        {
+            for (auto& [symbol, kernel] : levelTransitions[stateIndex - levelBegin])
+            {
+                const auto [position, inserted] = stateIndices.try_emplace(kernel, static_cast<int>(kernels.size()));
+                if (inserted)
+                {
+                    kernels.push_back(std::move(kernel));
+                }
+                transitions.push_back({symbol, stateIndex, position->second});
+            }
+        }
+        levelBegin = levelEnd;
+    }
+    const auto finalStateIndex = getFinalStateIndex(kernels, grammar);
+    return {std::move(kernels), std::move(transitions), finalStateIndex};
+}
+
+Automaton getAutomaton(const Grammar& grammar, const int threadsCount)
+{
+    const auto firstTable = getFirstTable(grammar);
+    const auto closureTemplates = getClosureTemplates(grammar, firstTable);
+    return buildAutomaton(grammar, getStartLookaheads(grammar),
+                          [&grammar, &firstTable, &closureTemplates](std::vector<Item> state)
+                          { return getStateClosure(std::move(state), grammar, firstTable, closureTemplates); },
+                          threadsCount);
+}
+
+Automaton getLr0Automaton(const Grammar& grammar, const int threadsCount)
+{
+    return buildAutomaton(
+        grammar, SymbolSet{},
+        [&grammar](std::vector<Item> state) { return getLr0StateClosure(std::move(state), grammar); }, threadsCount);
+}
+
+using Core = std::vector<std::pair<int, int>>;
+
+struct CoreHash
+{
+    std::size_t operator()(const Core& core) const
+    {
+        auto hash = hashSeed;
+        for (const auto& [ruleIndex, position] : core)
+        {
+            const auto value = (static_cast<std::uint64_t>(ruleIndex) << 32) ^ static_cast<std::uint64_t>(position);
+            hash = hashCombine(hash, value);
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
+static Core getCore(const std::vector<Item>& kernel)
+{
+    auto core = Core{};
+    for (const auto& item : kernel)
+    {
+        core.push_back({item.ruleIndex, item.position});
+    }
+    return core;
+}
+
+// Pager's weak compatibility: merging two states with the same core can't introduce a reduce/reduce conflict the
+// canonical automaton doesn't have if no two items end up sharing lookaheads they didn't already share in one of
+// the states.
+static bool areWeaklyCompatible(const std::vector<Item>& left, const std::vector<Item>& right)
+{
+    for (auto i = 0; i < static_cast<int>(left.size()); ++i)
+    {
+        for (auto j = 0; j < i; ++j)
+        {
+            if ((left[i].lookaheads.intersects(right[j].lookaheads) ||
+                 left[j].lookaheads.intersects(right[i].lookaheads)) &&
+                !left[i].lookaheads.intersects(left[j].lookaheads) &&
+                !right[i].lookaheads.intersects(right[j].lookaheads))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+Automaton getMinimalLr1Automaton(const Grammar& grammar)
+{
+    const auto firstTable = getFirstTable(grammar);
+    const auto closureTemplates = getClosureTemplates(grammar, firstTable);
+    const auto startItem = Item{grammar.getStartRuleIndex(), 0, getStartLookaheads(grammar)};
+
+    auto kernels = std::vector<std::vector<Item>>{{startItem}};
+    auto successors = std::vector<std::vector<std::pair<Symbol, int>>>(1);
+    auto statesByCore = std::unordered_map<Core, std::vector<int>, CoreHash>{{getCore(kernels.front()), {0}}};
+    auto scheduled = std::vector<bool>{true};
+    auto worklist = std::vector<int>{0};
+    while (!worklist.empty())
+    {
+        const auto stateIndex = worklist.back();
+        worklist.pop_back();
+        scheduled[stateIndex] = false;
+        successors[stateIndex].clear();
+        const auto closure = getStateClosure(kernels[stateIndex], grammar, firstTable, closureTemplates);
+        for (auto& [symbol, kernel] : getStateTransitions(closure, grammar))
+        {
+            std::sort(kernel.begin(), kernel.end());
+            auto& candidates = statesByCore[getCore(kernel)];
+            const auto candidate =
+                std::find_if(candidates.cbegin(), candidates.cend(), [&kernels, &kernel](const int index)
+                             { return areWeaklyCompatible(kernel, kernels[index]); });
+            if (candidate == candidates.cend())
+            {
+                const auto target = static_cast<int>(kernels.size());
+                candidates.push_back(target);
+                kernels.push_back(std::move(kernel));
+                successors.emplace_back();
+                scheduled.push_back(true);
+                worklist.push_back(target);
+                successors[stateIndex].push_back({symbol, target});
+                continue;
+            }
+
+            // Merged lookaheads have to be propagated again to the successors of the target.
+            const auto target = *candidate;
+            auto grown = false;
+            for (auto itemIndex = 0; itemIndex < static_cast<int>(kernel.size()); ++itemIndex)
+            {
+                auto added = kernel[itemIndex].lookaheads;
+                added -= kernels[target][itemIndex].lookaheads;
+                if (!added.empty())
+                {
+                    kernels[target][itemIndex].lookaheads |= added;
+                    grown = true;
+                }
+            }
+            if (grown)
+            {
+                if (!scheduled[target])
+                {
+                    scheduled[target] = true;
+                    worklist.push_back(target);
+                }
+            }
+            successors[stateIndex].push_back({symbol, target});
+        }
+    }
+
+    // States whose only predecessors moved on to other states after a merge are unreachable, so the automaton is made
+    // of the states reachable from the start state numbered in breadth first order.
+    auto renumbering = std::vector<int>(kernels.size(), -1);
+    auto order = std::vector<int>{0};
+    renumbering[0] = 0;
+    for (auto orderIndex = 0; orderIndex < static_cast<int>(order.size()); ++orderIndex)
+    {
+        for (const auto& successor : successors[order[orderIndex]])
+        {
+            if (renumbering[successor.second] == -1)
+            {
+                renumbering[successor.second] = static_cast<int>(order.size());
+                order.push_back(successor.second);
+            }
+        }
+    }
+    auto reachableKernels = std::vector<std::vector<Item>>{};
+    auto transitions = std::vector<Transition>{};
+    for (const auto stateIndex : order)
+    {
+        for (const auto& [symbol, target] : successors[stateIndex])
+        {
+            transitions.push_back({symbol, renumbering[stateIndex], renumbering[target]});
+        }
+        reachableKernels.push_back(std::move(kernels[stateIndex]));
+    }
+    const auto finalStateIndex = getFinalStateIndex(reachableKernels, grammar);
+    return {std::move(reachableKernels), std::move(transitions), finalStateIndex};
 }
 
 }
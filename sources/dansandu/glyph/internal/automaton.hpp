@@ -3,6 +3,7 @@
 #include "dansandu/glyph/internal/grammar.hpp"
 #include "dansandu/glyph/internal/item.hpp"
 #include "dansandu/glyph/internal/rule.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
 #include "dansandu/glyph/symbol.hpp"
 
 #include <map>
@@ -31,15 +32,42 @@ inline bool operator!=(const Transition& left, const Transition& right)
 
 std::ostream& operator<<(std::ostream& stream, const Transition& transition);
 
-std::vector<dansandu::glyph::symbol::Symbol>
+dansandu::glyph::internal::symbol_set::SymbolSet
 getFollowSet(const dansandu::glyph::internal::item::Item& item,
              const dansandu::glyph::internal::grammar::Grammar& grammar,
-             const std::vector<std::vector<dansandu::glyph::symbol::Symbol>>& firstTable);
+             const std::vector<dansandu::glyph::internal::symbol_set::SymbolSet>& firstTable);
+
+// A nonterminal pulled into the closure of a state by the nonterminal of the template, which follows the dot of some
+// item. The rules of the pulled nonterminal get the lookaheads spontaneously generated within the closure and, if the
+// lookaheads propagate, what can follow the template nonterminal in the item.
+struct ClosureEntry
+{
+    dansandu::glyph::symbol::Symbol nonTerminal;
+    dansandu::glyph::internal::symbol_set::SymbolSet spontaneousLookaheads;
+    bool propagatesLookaheads;
+};
+
+// Yields for each nonterminal the entries of its closure, starting with the nonterminal itself.
+std::vector<std::vector<ClosureEntry>>
+getClosureTemplates(const dansandu::glyph::internal::grammar::Grammar& grammar,
+                    const std::vector<dansandu::glyph::internal::symbol_set::SymbolSet>& firstTable);
+
+// Computes the closure templates on every call, prefer the overload taking them when closing many states.
+std::vector<dansandu::glyph::internal::item::Item>
+getStateClosure(std::vector<dansandu::glyph::internal::item::Item> state,
+                const dansandu::glyph::internal::grammar::Grammar& grammar,
+                const std::vector<dansandu::glyph::internal::symbol_set::SymbolSet>& firstTable);
 
 std::vector<dansandu::glyph::internal::item::Item>
 getStateClosure(std::vector<dansandu::glyph::internal::item::Item> state,
                 const dansandu::glyph::internal::grammar::Grammar& grammar,
-                const std::vector<std::vector<dansandu::glyph::symbol::Symbol>>& firstTable);
+                const std::vector<dansandu::glyph::internal::symbol_set::SymbolSet>& firstTable,
+                const std::vector<std::vector<ClosureEntry>>& closureTemplates);
+
+// Closes a state of the LR(0) automaton, whose items have no lookaheads.
+std::vector<dansandu::glyph::internal::item::Item>
+getLr0StateClosure(std::vector<dansandu::glyph::internal::item::Item> state,
+                   const dansandu::glyph::internal::grammar::Grammar& grammar);
 
 std::map<dansandu::glyph::symbol::Symbol, std::vector<dansandu::glyph::internal::item::Item>>
 getStateTransitions(const std::vector<dansandu::glyph::internal::item::Item>& state,
@@ -48,13 +76,24 @@ getStateTransitions(const std::vector<dansandu::glyph::internal::item::Item>& st
 bool isFinalState(const std::vector<dansandu::glyph::internal::item::Item>& state,
                   const dansandu::glyph::internal::grammar::Grammar& grammar);
 
+// States are stored as their sorted kernel items, the start item and the items whose dot isn't at the start of the
+// rule, since the closure items outnumber them by far and can be computed again from the kernel when needed.
 struct Automaton
 {
-    std::vector<std::vector<dansandu::glyph::internal::item::Item>> states;
+    std::vector<std::vector<dansandu::glyph::internal::item::Item>> kernels;
     std::vector<Transition> transitions;
     int finalStateIndex;
 };
 
-Automaton getAutomaton(const dansandu::glyph::internal::grammar::Grammar& grammar);
+// Builds the canonical LR(1) automaton. States are expanded on the given number of threads, or on as many threads as
+// the hardware supports if it isn't positive, and the result is the same for any number of threads.
+Automaton getAutomaton(const dansandu::glyph::internal::grammar::Grammar& grammar, const int threadsCount = 1);
+
+// Builds the LR(0) automaton whose items have no lookaheads.
+Automaton getLr0Automaton(const dansandu::glyph::internal::grammar::Grammar& grammar, const int threadsCount = 1);
+
+// Builds an LR(1) automaton as powerful as the canonical one by merging states with the same kernel items whenever
+// Pager's weak compatibility test allows it, which yields about as many states as the LR(0) automaton.
+Automaton getMinimalLr1Automaton(const dansandu::glyph::internal::grammar::Grammar& grammar);
 
 }
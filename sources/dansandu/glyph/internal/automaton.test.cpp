@@ -3,13 +3,18 @@
 #include "dansandu/glyph/error.hpp"
 #include "dansandu/glyph/internal/first_table.hpp"
 #include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
 
 #include <map>
 #include <vector>
 
 using dansandu::glyph::error::GrammarError;
 using dansandu::glyph::internal::automaton::getAutomaton;
+using dansandu::glyph::internal::automaton::getClosureTemplates;
 using dansandu::glyph::internal::automaton::getFollowSet;
+using dansandu::glyph::internal::automaton::getLr0Automaton;
+using dansandu::glyph::internal::automaton::getLr0StateClosure;
+using dansandu::glyph::internal::automaton::getMinimalLr1Automaton;
 using dansandu::glyph::internal::automaton::getStateClosure;
 using dansandu::glyph::internal::automaton::getStateTransitions;
 using dansandu::glyph::internal::automaton::isFinalState;
@@ -18,6 +23,7 @@ using dansandu::glyph::internal::first_table::getFirstTable;
 using dansandu::glyph::internal::grammar::Grammar;
 using dansandu::glyph::internal::item::Item;
 using dansandu::glyph::internal::rule::Rule;
+using dansandu::glyph::internal::symbol_set::SymbolSet;
 using dansandu::glyph::symbol::Symbol;
 
 using Items = std::vector<Item>;
@@ -43,46 +49,83 @@ TEST_CASE("Automaton")
 
     const auto firstTable = getFirstTable(grammar);
 
+    const auto item = [&grammar](const int ruleIndex, const int position, const std::vector<Symbol>& lookaheads)
+    {
+        auto lookaheadsSet = SymbolSet{grammar};
+        for (const auto lookahead : lookaheads)
+        {
+            lookaheadsSet.insert(lookahead);
+        }
+        return Item{ruleIndex, position, lookaheadsSet};
+    };
+
     SECTION("closure")
     {
         REQUIRE(getStateClosure({}, grammar, firstTable).empty());
 
-        REQUIRE(getStateClosure({Item{0, 0, end}}, grammar, firstTable) == Items{{
-            Item{0, 0, end},
-            Item{1, 0, end},
-            Item{1, 0, add},
-            Item{2, 0, end},
-            Item{2, 0, add},
-            Item{3, 0, end},
-            Item{3, 0, add},
-            Item{3, 0, multiply},
-            Item{4, 0, end},
-            Item{4, 0, add},
-            Item{4, 0, multiply}}
+        REQUIRE(getStateClosure({item(0, 0, {end})}, grammar, firstTable) == Items{{
+            item(0, 0, {end}),
+            item(1, 0, {end, add}),
+            item(2, 0, {end, add}),
+            item(3, 0, {end, add, multiply}),
+            item(4, 0, {end, add, multiply})}
         });
 
-        REQUIRE(getStateClosure({Item{0, 1, end}}, grammar, firstTable) == Items{Item{0, 1, end}});
+        REQUIRE(getStateClosure({item(0, 1, {end})}, grammar, firstTable) == Items{item(0, 1, {end})});
 
-        REQUIRE(getStateClosure({Item{1, 1, end}}, grammar, firstTable) == Items{Item{1, 1, end}});
+        REQUIRE(getStateClosure({item(1, 1, {end})}, grammar, firstTable) == Items{item(1, 1, {end})});
+
+        REQUIRE(getStateClosure({item(1, 1, {end}), item(1, 1, {add})}, grammar, firstTable) ==
+                Items{item(1, 1, {end, add})});
+    }
+
+    SECTION("closure templates")
+    {
+        const auto closureTemplates = getClosureTemplates(grammar, firstTable);
+
+        const auto& sumsTemplate = closureTemplates[Sums.getIdentifierIndex()];
+
+        REQUIRE(sumsTemplate.size() == 2);
+
+        REQUIRE(sumsTemplate[0].nonTerminal == Sums);
+
+        REQUIRE(sumsTemplate[0].spontaneousLookaheads.getSymbols() == std::vector<Symbol>{add});
+
+        REQUIRE(sumsTemplate[0].propagatesLookaheads);
+
+        REQUIRE(sumsTemplate[1].nonTerminal == Products);
+
+        REQUIRE(sumsTemplate[1].spontaneousLookaheads.getSymbols() == std::vector<Symbol>{add, multiply});
+
+        REQUIRE(sumsTemplate[1].propagatesLookaheads);
+
+        const auto& productsTemplate = closureTemplates[Products.getIdentifierIndex()];
+
+        REQUIRE(productsTemplate.size() == 1);
+
+        REQUIRE(productsTemplate[0].spontaneousLookaheads.getSymbols() == std::vector<Symbol>{multiply});
+
+        REQUIRE(getStateClosure({item(1, 2, {end, add})}, grammar, firstTable, closureTemplates) ==
+                getStateClosure({item(1, 2, {end, add})}, grammar, firstTable));
     }
 
     SECTION("transitions")
     {
         REQUIRE(getStateTransitions({}, grammar).empty());
 
-        REQUIRE(getStateTransitions({Item{0, 1, end}}, grammar).empty());
+        REQUIRE(getStateTransitions({item(0, 1, {end})}, grammar).empty());
 
         const auto state = Items{
-            Item{0, 0, end},
-            Item{1, 1, multiply},
-            Item{2, 0, add},
-            Item{3, 0, add}
+            item(0, 0, {end}),
+            item(1, 1, {multiply}),
+            item(2, 0, {add}),
+            item(3, 0, {add, multiply})
         };
 
         const auto expectedTransitions = Transitions{
-            {add,      {Item{1, 2, multiply}}},
-            {Products, {Item{2, 1, add}, Item{3, 1, add}}},
-            {Sums,     {Item{0, 1, end}}}
+            {add,      {item(1, 2, {multiply})}},
+            {Products, {item(2, 1, {add}), item(3, 1, {add, multiply})}},
+            {Sums,     {item(0, 1, {end})}}
         };
 
         REQUIRE(getStateTransitions(state, grammar) == expectedTransitions);
@@ -90,63 +133,56 @@ TEST_CASE("Automaton")
 
     SECTION("final state")
     {
-        REQUIRE(isFinalState({Item{0, 1, end}, Item{1, 1, end}}, grammar));
+        REQUIRE(isFinalState({item(0, 1, {end}), item(1, 1, {end})}, grammar));
 
-        REQUIRE(!isFinalState({Item{0, 0, end}, Item{1, 1, end}, Item{2, 0, end}}, grammar));
+        REQUIRE(!isFinalState({item(0, 0, {end}), item(1, 1, {end}), item(2, 0, {end})}, grammar));
     }
 
     SECTION("automaton") {
         const auto automaton = getAutomaton(grammar);
 
-        REQUIRE(automaton.states == std::vector<Items>{
-            Items{Item{0, 0, end},
-                  Item{1, 0, end},
-                  Item{1, 0, add},
-                  Item{2, 0, end},
-                  Item{2, 0, add},
-                  Item{3, 0, end},
-                  Item{3, 0, add},
-                  Item{3, 0, multiply},
-                  Item{4, 0, end},
-                  Item{4, 0, add},
-                  Item{4, 0, multiply}},
-
-            Items{Item{0, 1, end},
-                  Item{1, 1, end},
-                  Item{1, 1, add}},
-    
-            Items{Item{2, 1, end},
-                  Item{2, 1, add},
-                  Item{3, 1, end},
-                  Item{3, 1, add},
-                  Item{3, 1, multiply}},
-    
-            Items{Item{4, 1, end},
-                  Item{4, 1, add},
-                  Item{4, 1, multiply}},
-        
-            Items{Item{1, 2, end},
-                  Item{1, 2, add},
-                  Item{3, 0, end},
-                  Item{3, 0, add},
-                  Item{3, 0, multiply},
-                  Item{4, 0, end},
-                  Item{4, 0, add},
-                  Item{4, 0, multiply}},
-
-            Items{Item{3, 2, end},
-                  Item{3, 2, add},
-                  Item{3, 2, multiply}},
-    
-            Items{Item{1, 3, end},
-                  Item{1, 3, add},
-                  Item{3, 1, end},
-                  Item{3, 1, add},
-                  Item{3, 1, multiply}},
-
-            Items{Item{3, 3, end},
-                  Item{3, 3, add},
-                  Item{3, 3, multiply}}
+        auto states = std::vector<Items>{};
+        for (const auto& kernel : automaton.kernels)
+        {
+            states.push_back(getStateClosure(kernel, grammar, firstTable));
+        }
+
+        REQUIRE(automaton.kernels == std::vector<Items>{
+            Items{item(0, 0, {end})},
+            Items{item(0, 1, {end}), item(1, 1, {end, add})},
+            Items{item(2, 1, {end, add}), item(3, 1, {end, add, multiply})},
+            Items{item(4, 1, {end, add, multiply})},
+            Items{item(1, 2, {end, add})},
+            Items{item(3, 2, {end, add, multiply})},
+            Items{item(1, 3, {end, add}), item(3, 1, {end, add, multiply})},
+            Items{item(3, 3, {end, add, multiply})}
+        });
+
+        REQUIRE(states == std::vector<Items>{
+            Items{item(0, 0, {end}),
+                  item(1, 0, {end, add}),
+                  item(2, 0, {end, add}),
+                  item(3, 0, {end, add, multiply}),
+                  item(4, 0, {end, add, multiply})},
+
+            Items{item(0, 1, {end}),
+                  item(1, 1, {end, add})},
+
+            Items{item(2, 1, {end, add}),
+                  item(3, 1, {end, add, multiply})},
+
+            Items{item(4, 1, {end, add, multiply})},
+
+            Items{item(1, 2, {end, add}),
+                  item(3, 0, {end, add, multiply}),
+                  item(4, 0, {end, add, multiply})},
+
+            Items{item(3, 2, {end, add, multiply})},
+
+            Items{item(1, 3, {end, add}),
+                  item(3, 1, {end, add, multiply})},
+
+            Items{item(3, 3, {end, add, multiply})}
         });
 
         REQUIRE(automaton.transitions == std::vector<Transition>{
@@ -161,5 +197,100 @@ TEST_CASE("Automaton")
             Transition{multiply, 6, 5}
         });
     }
+
+    SECTION("LR(0) automaton") {
+        const auto automaton = getLr0Automaton(grammar);
+
+        auto states = std::vector<Items>{};
+        for (const auto& kernel : automaton.kernels)
+        {
+            states.push_back(getLr0StateClosure(kernel, grammar));
+        }
+
+        REQUIRE(states == std::vector<Items>{
+            Items{Item{0, 0}, Item{1, 0}, Item{2, 0}, Item{3, 0}, Item{4, 0}},
+            Items{Item{0, 1}, Item{1, 1}},
+            Items{Item{2, 1}, Item{3, 1}},
+            Items{Item{4, 1}},
+            Items{Item{1, 2}, Item{3, 0}, Item{4, 0}},
+            Items{Item{3, 2}},
+            Items{Item{1, 3}, Item{3, 1}},
+            Items{Item{3, 3}}
+        });
+
+        REQUIRE(automaton.transitions == getAutomaton(grammar).transitions);
+
+        REQUIRE(automaton.finalStateIndex == 1);
+    }
+
+    SECTION("minimal LR(1) automaton")
+    {
+        const auto automaton = getMinimalLr1Automaton(grammar);
+
+        REQUIRE(automaton.kernels == getAutomaton(grammar).kernels);
+
+        REQUIRE(automaton.transitions == getAutomaton(grammar).transitions);
+
+        const auto nested = Grammar{R"(
+            Start -> Sums
+            Sums  -> Sums add Value
+            Sums  -> Value
+            Value -> number
+            Value -> open Sums close
+        )"};
+
+        REQUIRE(getMinimalLr1Automaton(nested).kernels.size() == getLr0Automaton(nested).kernels.size());
+
+        REQUIRE(getMinimalLr1Automaton(nested).kernels.size() < getAutomaton(nested).kernels.size());
+
+        const auto notLalr1 = Grammar{R"(
+            Start -> S
+            S -> a E c
+            S -> a F d
+            S -> b F c
+            S -> b E d
+            E -> e
+            F -> e
+        )"};
+
+        REQUIRE(getMinimalLr1Automaton(notLalr1).kernels.size() == getLr0Automaton(notLalr1).kernels.size() + 1);
+    }
+
+    SECTION("parallel construction")
+    {
+        const auto arithmetic = Grammar{R"(
+            Start    -> Sums
+            Sums     -> Sums plus Products
+            Sums     -> Sums minus Products
+            Sums     -> Products
+            Products -> Products multiply Signed
+            Products -> Products divide Signed
+            Products -> Signed
+            Signed   -> minus Value
+            Signed   -> Value
+            Value    -> identifier
+            Value    -> number
+            Value    -> identifier open Arguments close
+            Value    -> open Sums close
+            Arguments -> Arguments comma Sums
+            Arguments -> Sums
+            Arguments ->
+        )"};
+
+        const auto serial = getAutomaton(arithmetic);
+
+        for (const auto threadsCount : {2, 3, 8, 0})
+        {
+            const auto parallel = getAutomaton(arithmetic, threadsCount);
+
+            REQUIRE(parallel.kernels == serial.kernels);
+
+            REQUIRE(parallel.transitions == serial.transitions);
+
+            REQUIRE(parallel.finalStateIndex == serial.finalStateIndex);
+
+            REQUIRE(getLr0Automaton(arithmetic, threadsCount).transitions == getLr0Automaton(arithmetic).transitions);
+        }
+    }
 }
 // clang-format on
@@ -0,0 +1,119 @@
+#include "dansandu/glyph/internal/character_skipper.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GLYPH_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define GLYPH_AVX2
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace dansandu::glyph::internal::character_skipper
+{
+
+static constexpr auto maximumVectorizedCharacters = 8U;
+
+#if defined(GLYPH_SSE2) || defined(GLYPH_AVX2)
+static int countTrailingZeros(const unsigned int mask)
+{
+#if defined(_MSC_VER)
+    auto index = 0UL;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+CharacterSkipper::CharacterSkipper(const std::string_view characters) : table_{}
+{
+    for (const auto character : characters)
+    {
+        const auto byte = static_cast<unsigned char>(character);
+        if (!table_[byte])
+        {
+            table_[byte] = true;
+            characters_.push_back(byte);
+        }
+    }
+}
+
+std::int64_t CharacterSkipper::skip(const std::string_view text, std::int64_t position) const
+{
+    const auto size = static_cast<std::int64_t>(text.size());
+    const auto data = text.data();
+
+    if (position == size || !table_[static_cast<unsigned char>(data[position])])
+    {
+        return position;
+    }
+
+    if (characters_.size() <= maximumVectorizedCharacters)
+    {
+        const auto count = static_cast<int>(characters_.size());
+#if defined(GLYPH_AVX2)
+        __m256i wideNeedles[maximumVectorizedCharacters];
+        for (auto index = 0; index < count; ++index)
+        {
+            wideNeedles[index] = _mm256_set1_epi8(static_cast<char>(characters_[index]));
+        }
+        while (position + 32 <= size)
+        {
+            const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position));
+            auto matches = _mm256_setzero_si256();
+            for (auto index = 0; index < count; ++index)
+            {
+                matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, wideNeedles[index]));
+            }
+            const auto mask = static_cast<unsigned int>(_mm256_movemask_epi8(matches));
+            if (mask != 0xFFFFFFFFU)
+            {
+                return position + countTrailingZeros(~mask);
+            }
+            position += 32;
+        }
+#endif
+#if defined(GLYPH_SSE2)
+        __m128i needles[maximumVectorizedCharacters];
+        for (auto index = 0; index < count; ++index)
+        {
+            needles[index] = _mm_set1_epi8(static_cast<char>(characters_[index]));
+        }
+        while (position + 16 <= size)
+        {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            auto matches = _mm_setzero_si128();
+            for (auto index = 0; index < count; ++index)
+            {
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, needles[index]));
+            }
+            const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(matches));
+            if (mask != 0xFFFFU)
+            {
+                return position + countTrailingZeros(~mask & 0xFFFFU);
+            }
+            position += 16;
+        }
+#endif
+    }
+
+    while (position < size && table_[static_cast<unsigned char>(data[position])])
+    {
+        ++position;
+    }
+    return position;
+}
+
+}
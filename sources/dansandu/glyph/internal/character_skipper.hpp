@@ -0,0 +1,31 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace dansandu::glyph::internal::character_skipper
+{
+
+// Skips runs of characters from a small set, such as whitespace, using SSE2 or AVX2 comparisons when available. Sets of
+// more than eight characters and targets without these instruction sets fall back to a table lookup per character.
+class CharacterSkipper
+{
+public:
+    explicit CharacterSkipper(const std::string_view characters);
+
+    bool empty() const
+    {
+        return characters_.empty();
+    }
+
+    // Yields the first position at or after the given one whose character is not in the set.
+    std::int64_t skip(const std::string_view text, std::int64_t position) const;
+
+private:
+    std::array<bool, 256> table_;
+    std::vector<unsigned char> characters_;
+};
+
+}
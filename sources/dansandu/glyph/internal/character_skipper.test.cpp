@@ -0,0 +1,65 @@
+#include "dansandu/glyph/internal/character_skipper.hpp"
+#include "catchorg/catch/catch.hpp"
+
+#include <string>
+
+using dansandu::glyph::internal::character_skipper::CharacterSkipper;
+
+TEST_CASE("CharacterSkipper")
+{
+    SECTION("empty set")
+    {
+        const auto skipper = CharacterSkipper{""};
+
+        REQUIRE(skipper.empty());
+
+        REQUIRE(skipper.skip("  a", 0) == 0);
+    }
+
+    SECTION("short runs")
+    {
+        const auto skipper = CharacterSkipper{" \t\n"};
+
+        REQUIRE(!skipper.empty());
+
+        REQUIRE(skipper.skip("", 0) == 0);
+
+        REQUIRE(skipper.skip("a b", 0) == 0);
+
+        REQUIRE(skipper.skip("a b", 1) == 2);
+
+        REQUIRE(skipper.skip("a \t\n", 1) == 4);
+    }
+
+    SECTION("long runs")
+    {
+        const auto skipper = CharacterSkipper{" \t\r\n"};
+
+        for (auto length = 0; length < 100; ++length)
+        {
+            auto text = std::string{"x"};
+            for (auto index = 0; index < length; ++index)
+            {
+                text += " \t\r\n"[index % 4];
+            }
+
+            REQUIRE(skipper.skip(text, 1) == length + 1);
+
+            REQUIRE(skipper.skip(text + "y" + std::string(40, ' '), 1) == length + 1);
+        }
+    }
+
+    SECTION("many characters")
+    {
+        const auto skipper = CharacterSkipper{"0123456789abcdef"};
+
+        REQUIRE(skipper.skip("deadbeef0123456789abcdefxyz", 0) == 24);
+    }
+
+    SECTION("high bytes")
+    {
+        const auto skipper = CharacterSkipper{"\xA0 "};
+
+        REQUIRE(skipper.skip(std::string(20, '\xA0') + std::string(20, ' ') + "\xA1", 0) == 40);
+    }
+}
@@ -0,0 +1,144 @@
+#include "dansandu/glyph/internal/compressed_parsing_table.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/parsing_table.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::parsing_table::Action;
+using dansandu::glyph::internal::parsing_table::Cell;
+using dansandu::glyph::internal::symbol_set::hashCombine;
+using dansandu::glyph::internal::symbol_set::hashSeed;
+using dansandu::glyph::symbol::Symbol;
+
+namespace dansandu::glyph::internal::compressed_parsing_table
+{
+
+using Row = std::vector<std::pair<int, Cell>>;
+
+struct RowHash
+{
+    std::size_t operator()(const Row& row) const
+    {
+        auto hash = hashSeed;
+        for (const auto& [symbolIndex, cell] : row)
+        {
+            const auto value = (static_cast<std::uint64_t>(symbolIndex) << 40) ^
+                               (static_cast<std::uint64_t>(cell.action) << 32) ^
+                               static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell.parameter));
+            hash = hashCombine(hash, value);
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
+CompressedParsingTable getCompressedParsingTable(const std::vector<std::vector<Cell>>& parsingTable)
+{
+    return getCompressedParsingTable(parsingTable,
+                                     std::vector<Cell>(parsingTable.empty() ? 0 : parsingTable.front().size()));
+}
+
+CompressedParsingTable getCompressedParsingTable(const std::vector<std::vector<Cell>>& parsingTable,
+                                                 std::vector<Cell> defaultCells)
+{
+    const auto symbolsCount = static_cast<int>(parsingTable.size());
+    const auto statesCount = static_cast<int>(defaultCells.size());
+    auto rows = std::vector<Row>(statesCount);
+    for (auto symbolIndex = 0; symbolIndex < symbolsCount; ++symbolIndex)
+    {
+        for (auto stateIndex = 0; stateIndex < statesCount; ++stateIndex)
+        {
+            const auto cell = parsingTable[symbolIndex][stateIndex];
+            if (cell.action != Action::error && cell != defaultCells[stateIndex])
+            {
+                rows[stateIndex].push_back({symbolIndex, cell});
+            }
+        }
+    }
+
+    // The densest rows are placed first, each at the lowest unused base where its cells only land on free slots.
+    auto order = std::vector<int>(statesCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&rows](const int left, const int right) { return rows[left].size() > rows[right].size(); });
+    auto table = CompressedParsingTable{std::vector<int>(statesCount), std::move(defaultCells), {}, {}, symbolsCount};
+    auto usedBases = std::vector<bool>{};
+    auto rowBases = std::unordered_map<Row, int, RowHash>{};
+    auto firstFreeSlot = 0;
+    for (const auto stateIndex : order)
+    {
+        const auto& row = rows[stateIndex];
+        const auto [position, inserted] = rowBases.try_emplace(row, 0);
+        if (!inserted)
+        {
+            table.bases[stateIndex] = position->second;
+            continue;
+        }
+        const auto isFree = [&table](const int slot)
+        { return slot >= static_cast<int>(table.checks.size()) || table.checks[slot] == -1; };
+        auto base = row.empty() ? 0 : std::max(0, firstFreeSlot - row.front().first);
+        while ((base < static_cast<int>(usedBases.size()) && usedBases[base]) ||
+               !std::all_of(row.cbegin(), row.cend(),
+                            [&isFree, base](const auto& entry) { return isFree(base + entry.first); }))
+        {
+            ++base;
+        }
+        if (!row.empty() && base + row.back().first >= static_cast<int>(table.checks.size()))
+        {
+            table.checks.resize(base + row.back().first + 1, -1);
+            table.cells.resize(table.checks.size());
+        }
+        for (const auto& [symbolIndex, cell] : row)
+        {
+            table.checks[base + symbolIndex] = symbolIndex;
+            table.cells[base + symbolIndex] = cell;
+        }
+        if (base >= static_cast<int>(usedBases.size()))
+        {
+            usedBases.resize(base + 1);
+        }
+        usedBases[base] = true;
+        position->second = base;
+        table.bases[stateIndex] = base;
+        while (!isFree(firstFreeSlot))
+        {
+            ++firstFreeSlot;
+        }
+    }
+    table.checks.resize(usedBases.size() + symbolsCount, -1);
+    table.cells.resize(table.checks.size());
+    return table;
+}
+
+std::vector<std::vector<Symbol>> getExpectedSymbols(const Grammar& grammar, const CompressedParsingTable& table)
+{
+    const auto statesCount = static_cast<int>(table.bases.size());
+    auto expectedSymbols = std::vector<std::vector<Symbol>>(statesCount);
+    for (auto stateIndex = 0; stateIndex < statesCount; ++stateIndex)
+    {
+        if (table.defaultCells[stateIndex].action == Action::reduce)
+        {
+            continue;
+        }
+        expectedSymbols[stateIndex].push_back(grammar.getDiscardedSymbolPlaceholder());
+        for (auto symbolIndex = grammar.getEndOfStringSymbol().getIdentifierIndex(); symbolIndex < table.symbolsCount;
+             ++symbolIndex)
+        {
+            if (getCell(table, symbolIndex, stateIndex).action != Action::error)
+            {
+                expectedSymbols[stateIndex].push_back(Symbol{symbolIndex});
+            }
+        }
+    }
+    return expectedSymbols;
+}
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/parsing_table.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <vector>
+
+namespace dansandu::glyph::internal::compressed_parsing_table
+{
+
+// Parsing table compressed by row displacement. The cells of a state that differ from its default cell are stored in
+// the slots given by the base of the state plus their symbol index, and the rows of the states are displaced so that
+// they interleave without sharing slots. A slot holds a cell of a state's row only if its check is the symbol, so the
+// bases are unique except for states with identical rows, which share their slots. Slots are padded so that every
+// symbol of every state has one and lookups never go out of bounds.
+struct CompressedParsingTable
+{
+    std::vector<int> bases;
+    std::vector<dansandu::glyph::internal::parsing_table::Cell> defaultCells;
+    std::vector<int> checks;
+    std::vector<dansandu::glyph::internal::parsing_table::Cell> cells;
+    int symbolsCount;
+};
+
+inline dansandu::glyph::internal::parsing_table::Cell
+getCell(const CompressedParsingTable& table, const int symbolIndex, const int stateIndex)
+{
+    const auto slot = table.bases[stateIndex] + symbolIndex;
+    return table.checks[slot] == symbolIndex ? table.cells[slot] : table.defaultCells[stateIndex];
+}
+
+// Compresses a table indexed by symbol and state whose default cells are the error cells.
+CompressedParsingTable
+getCompressedParsingTable(const std::vector<std::vector<dansandu::glyph::internal::parsing_table::Cell>>& parsingTable);
+
+// Compresses a table with the given default cell for each state, such as its default reduction. The error cells of a
+// state become its default cell, so only the cells that are neither errors nor the default are stored.
+CompressedParsingTable
+getCompressedParsingTable(const std::vector<std::vector<dansandu::glyph::internal::parsing_table::Cell>>& parsingTable,
+                          std::vector<dansandu::glyph::internal::parsing_table::Cell> defaultCells);
+
+// States with a default reduction get an empty list since they reduce without reading the next token.
+std::vector<std::vector<dansandu::glyph::symbol::Symbol>>
+getExpectedSymbols(const dansandu::glyph::internal::grammar::Grammar& grammar, const CompressedParsingTable& table);
+
+}
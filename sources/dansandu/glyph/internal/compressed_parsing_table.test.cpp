@@ -0,0 +1,167 @@
+#include "dansandu/glyph/internal/compressed_parsing_table.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/parsing.hpp"
+#include "dansandu/glyph/internal/parsing_table.hpp"
+#include "dansandu/glyph/regex_tokenizer.hpp"
+#include "dansandu/glyph/tokenizer.hpp"
+
+#include <string>
+#include <vector>
+
+using dansandu::glyph::error::SyntaxError;
+using dansandu::glyph::internal::automaton::getAutomaton;
+using dansandu::glyph::internal::automaton::getLr0Automaton;
+using dansandu::glyph::internal::compressed_parsing_table::getCell;
+using dansandu::glyph::internal::compressed_parsing_table::getCompressedParsingTable;
+using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::parsing::parse;
+using dansandu::glyph::internal::parsing_table::Action;
+using dansandu::glyph::internal::parsing_table::getClr1ParsingTable;
+using dansandu::glyph::internal::parsing_table::getDefaultReductions;
+using dansandu::glyph::internal::parsing_table::getLalr1ParsingTable;
+using dansandu::glyph::regex_tokenizer::RegexTokenizer;
+using dansandu::glyph::tokenizer::TokenViewStream;
+
+namespace compressed_parsing_table = dansandu::glyph::internal::compressed_parsing_table;
+namespace parsing_table = dansandu::glyph::internal::parsing_table;
+
+TEST_CASE("Compressed parsing table")
+{
+    const auto grammar = Grammar{R"(
+        Start       -> Sums
+        Sums        -> Sums plus Products
+        Sums        -> Products
+        Products    -> Products multiply SignedValue
+        Products    -> SignedValue
+        SignedValue -> Value
+        SignedValue -> minus Value
+        Value       -> number
+        Value       -> identifier
+        Value       -> open Sums close
+    )"};
+
+    const auto parsingTable = getClr1ParsingTable(grammar, getAutomaton(grammar));
+    const auto symbolsCount = static_cast<int>(parsingTable.size());
+    const auto statesCount = static_cast<int>(parsingTable.front().size());
+
+    SECTION("lookups")
+    {
+        const auto compressed = getCompressedParsingTable(parsingTable);
+
+        for (auto symbolIndex = 0; symbolIndex < symbolsCount; ++symbolIndex)
+        {
+            for (auto stateIndex = 0; stateIndex < statesCount; ++stateIndex)
+            {
+                REQUIRE(getCell(compressed, symbolIndex, stateIndex) == parsingTable[symbolIndex][stateIndex]);
+            }
+        }
+
+        REQUIRE(compressed.checks.size() == compressed.cells.size());
+
+        REQUIRE(static_cast<int>(compressed.cells.size()) < symbolsCount * statesCount / 2);
+
+        REQUIRE(compressed_parsing_table::getExpectedSymbols(grammar, compressed) ==
+                parsing_table::getExpectedSymbols(grammar, parsingTable));
+    }
+
+    SECTION("identical rows")
+    {
+        const auto lalr1Table = getLalr1ParsingTable(grammar, getLr0Automaton(grammar));
+        const auto compressed = getCompressedParsingTable(lalr1Table);
+        const auto lalr1StatesCount = static_cast<int>(lalr1Table.front().size());
+
+        for (auto left = 0; left < lalr1StatesCount; ++left)
+        {
+            for (auto right = 0; right < left; ++right)
+            {
+                auto identical = true;
+                for (const auto& row : lalr1Table)
+                {
+                    identical = identical && row[left] == row[right];
+                }
+                REQUIRE((compressed.bases[left] == compressed.bases[right]) == identical);
+            }
+        }
+    }
+
+    SECTION("default reductions")
+    {
+        const auto defaultReductions = getDefaultReductions(parsingTable);
+        const auto compressed = getCompressedParsingTable(parsingTable, defaultReductions);
+
+        REQUIRE(compressed.cells.size() < getCompressedParsingTable(parsingTable).cells.size());
+
+        const auto expectedSymbols = compressed_parsing_table::getExpectedSymbols(grammar, compressed);
+        const auto uncompressedExpectedSymbols = parsing_table::getExpectedSymbols(grammar, parsingTable);
+
+        for (auto stateIndex = 0; stateIndex < statesCount; ++stateIndex)
+        {
+            REQUIRE(compressed.defaultCells[stateIndex] == defaultReductions[stateIndex]);
+
+            if (defaultReductions[stateIndex].action == Action::reduce)
+            {
+                REQUIRE(expectedSymbols[stateIndex].empty());
+            }
+            else
+            {
+                REQUIRE(expectedSymbols[stateIndex] == uncompressedExpectedSymbols[stateIndex]);
+            }
+
+            for (auto symbolIndex = 0; symbolIndex < symbolsCount; ++symbolIndex)
+            {
+                const auto cell = parsingTable[symbolIndex][stateIndex];
+                if (cell.action != Action::error || defaultReductions[stateIndex].action == Action::error)
+                {
+                    REQUIRE(getCell(compressed, symbolIndex, stateIndex) == cell);
+                }
+                else
+                {
+                    REQUIRE(getCell(compressed, symbolIndex, stateIndex) == defaultReductions[stateIndex]);
+                }
+            }
+        }
+    }
+
+    SECTION("empty table")
+    {
+        const auto compressed = getCompressedParsingTable({});
+
+        REQUIRE(compressed.bases.empty());
+
+        REQUIRE(compressed.checks.empty());
+    }
+
+    SECTION("parsing")
+    {
+        const auto compressed = getCompressedParsingTable(parsingTable, getDefaultReductions(parsingTable));
+        const auto expectedSymbols = compressed_parsing_table::getExpectedSymbols(grammar, compressed);
+
+        const auto tokenizer = RegexTokenizer{{{grammar.getSymbol("identifier"), "[a-z]\\w*"},
+                                               {grammar.getSymbol("number"), "\\d+"},
+                                               {grammar.getSymbol("plus"), "\\+"},
+                                               {grammar.getSymbol("minus"), "-"},
+                                               {grammar.getSymbol("multiply"), "\\*"},
+                                               {grammar.getSymbol("open"), "\\("},
+                                               {grammar.getSymbol("close"), "\\)"},
+                                               {grammar.getDiscardedSymbolPlaceholder(), "\\s+"}}};
+
+        const auto text = std::string{"-(a + (b * 3)) * (1 + -c)"};
+        const auto tokens = tokenizer.tokenize(text);
+        auto tokenStream = TokenViewStream{tokens};
+
+        REQUIRE(parse(text, tokenStream, compressed, expectedSymbols, grammar) ==
+                parse(text, tokens, parsingTable, grammar));
+
+        for (const auto invalidText : {"a *", "(a + b", "x y", "(a) b", "a + 1 2", ""})
+        {
+            const auto invalidTokens = tokenizer.tokenize(invalidText);
+            auto invalidTokenStream = TokenViewStream{invalidTokens};
+
+            REQUIRE_THROWS_AS(parse(invalidText, invalidTokenStream, compressed, expectedSymbols, grammar),
+                              SyntaxError);
+        }
+    }
+}
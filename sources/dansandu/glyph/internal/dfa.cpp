@@ -0,0 +1,152 @@
+#include "dansandu/glyph/internal/dfa.hpp"
+#include "dansandu/glyph/internal/nfa.hpp"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+using dansandu::glyph::internal::nfa::getEpsilonClosure;
+using dansandu::glyph::internal::nfa::Nfa;
+
+namespace dansandu::glyph::internal::dfa
+{
+
+static Nfa combine(const std::vector<Nfa>& nfas, std::vector<int>& finalStatesPatterns)
+{
+    auto combined = Nfa{};
+    combined.startStateIndex = 0;
+    combined.finalStateIndex = -1;
+    combined.states.push_back({{}, -1, {}});
+    for (auto patternIndex = 0; patternIndex < static_cast<int>(nfas.size()); ++patternIndex)
+    {
+        const auto& nfa = nfas[patternIndex];
+        const auto offset = static_cast<int>(combined.states.size());
+        for (const auto& state : nfa.states)
+        {
+            auto epsilonTransitions = state.epsilonTransitions;
+            for (auto& stateIndex : epsilonTransitions)
+            {
+                stateIndex += offset;
+            }
+            combined.states.push_back({state.characters, state.next != -1 ? state.next + offset : -1,
+                                       std::move(epsilonTransitions)});
+        }
+        combined.states.front().epsilonTransitions.push_back(nfa.startStateIndex + offset);
+        finalStatesPatterns.resize(combined.states.size(), -1);
+        finalStatesPatterns[nfa.finalStateIndex + offset] = patternIndex;
+    }
+    finalStatesPatterns.resize(combined.states.size(), -1);
+    return combined;
+}
+
+static int getByteClasses(const Nfa& nfa, std::array<int, 256>& byteClasses)
+{
+    byteClasses.fill(0);
+    auto classesCount = 1;
+    for (const auto& state : nfa.states)
+    {
+        if (state.next == -1)
+        {
+            continue;
+        }
+        auto renumbering = std::vector<int>(classesCount * 2, -1);
+        auto newClassesCount = 0;
+        for (auto byte = 0; byte < 256; ++byte)
+        {
+            auto& newClass = renumbering[byteClasses[byte] * 2 + static_cast<int>(state.characters[byte])];
+            if (newClass == -1)
+            {
+                newClass = newClassesCount++;
+            }
+            byteClasses[byte] = newClass;
+        }
+        classesCount = newClassesCount;
+    }
+    return classesCount;
+}
+
+Dfa getDfa(const std::vector<Nfa>& nfas)
+{
+    auto finalStatesPatterns = std::vector<int>{};
+    const auto nfa = combine(nfas, finalStatesPatterns);
+
+    auto dfa = Dfa{};
+    dfa.classesCount = getByteClasses(nfa, dfa.byteClasses);
+
+    auto representatives = std::vector<int>(dfa.classesCount, -1);
+    for (auto byte = 0; byte < 256; ++byte)
+    {
+        if (representatives[dfa.byteClasses[byte]] == -1)
+        {
+            representatives[dfa.byteClasses[byte]] = byte;
+        }
+    }
+
+    auto subsets = std::vector<std::vector<int>>{getEpsilonClosure(nfa, {nfa.startStateIndex})};
+    auto subsetsIndices = std::map<std::vector<int>, int>{{subsets.front(), 0}};
+    for (auto dfaStateIndex = 0; dfaStateIndex < static_cast<int>(subsets.size()); ++dfaStateIndex)
+    {
+        auto acceptedPatterns = std::vector<int>{};
+        for (const auto nfaStateIndex : subsets[dfaStateIndex])
+        {
+            if (const auto pattern = finalStatesPatterns[nfaStateIndex]; pattern != -1)
+            {
+                acceptedPatterns.push_back(pattern);
+            }
+        }
+        std::sort(acceptedPatterns.begin(), acceptedPatterns.end());
+        dfa.acceptedPatterns.push_back(acceptedPatterns.empty() ? -1 : acceptedPatterns.front());
+        dfa.allAcceptedPatterns.push_back(std::move(acceptedPatterns));
+
+        for (auto byteClass = 0; byteClass < dfa.classesCount; ++byteClass)
+        {
+            const auto byte = representatives[byteClass];
+            auto targets = std::vector<int>{};
+            for (const auto nfaStateIndex : subsets[dfaStateIndex])
+            {
+                const auto& nfaState = nfa.states[nfaStateIndex];
+                if (nfaState.next != -1 && nfaState.characters[byte])
+                {
+                    targets.push_back(nfaState.next);
+                }
+            }
+            if (targets.empty())
+            {
+                dfa.transitions.push_back(-1);
+                continue;
+            }
+            auto subset = getEpsilonClosure(nfa, std::move(targets));
+            const auto [position, inserted] = subsetsIndices.insert({subset, static_cast<int>(subsets.size())});
+            if (inserted)
+            {
+                subsets.push_back(std::move(subset));
+            }
+            dfa.transitions.push_back(position->second);
+        }
+    }
+
+    dfa.reachablePatterns = dfa.acceptedPatterns;
+    auto changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (auto state = 0; state < static_cast<int>(subsets.size()); ++state)
+        {
+            auto& reachable = dfa.reachablePatterns[state];
+            for (auto byteClass = 0; byteClass < dfa.classesCount; ++byteClass)
+            {
+                const auto next = dfa.transitions[state * dfa.classesCount + byteClass];
+                const auto nextReachable = next != -1 ? dfa.reachablePatterns[next] : -1;
+                if (nextReachable != -1 && (reachable == -1 || nextReachable < reachable))
+                {
+                    reachable = nextReachable;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    return dfa;
+}
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "dansandu/glyph/internal/nfa.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dansandu::glyph::internal::dfa
+{
+
+// Deterministic automaton recognizing several patterns at once. Bytes that no pattern tells apart share a class so the
+// transition table only has one column per class. The start state has index 0 and missing transitions are -1.
+struct Dfa
+{
+    std::array<int, 256> byteClasses;
+    int classesCount;
+    std::vector<int> transitions;
+    std::vector<int> acceptedPatterns;
+    std::vector<int> reachablePatterns;
+    std::vector<std::vector<int>> allAcceptedPatterns;
+};
+
+// The accepted pattern of a state is the lowest index of the automata that accept in that state, or -1 if none does.
+// The reachable pattern is the lowest pattern index accepted by the state or any of its successors, or -1 if none is.
+// All accepted patterns lists every pattern accepted in the state in ascending order.
+Dfa getDfa(const std::vector<dansandu::glyph::internal::nfa::Nfa>& nfas);
+
+// Scans the automaton from the position and yields the lowest index pattern accepted along the way together with the
+// end of its longest match, or -1 and the position if no pattern matches. The scan stops as soon as no state ahead can
+// accept a better pattern. The automaton is either a Dfa or a StaticDfa of the static_automaton module, which has the
+// same layout, so both tokenizers share this loop.
+template<typename Automaton>
+constexpr std::pair<int, std::int64_t> matchLongestPattern(const Automaton& dfa, const int classesCount,
+                                                           const std::string_view text, const std::int64_t position)
+{
+    const auto textSize = static_cast<std::int64_t>(text.size());
+    auto state = 0;
+    auto acceptedPattern = -1;
+    auto acceptedEnd = position;
+    for (auto current = position; current < textSize; ++current)
+    {
+        state = dfa.transitions[state * classesCount + dfa.byteClasses[static_cast<unsigned char>(text[current])]];
+        if (state == -1)
+        {
+            break;
+        }
+        const auto pattern = dfa.acceptedPatterns[state];
+        if (pattern != -1 && (acceptedPattern == -1 || pattern <= acceptedPattern))
+        {
+            acceptedPattern = pattern;
+            acceptedEnd = current + 1;
+        }
+        const auto reachable = dfa.reachablePatterns[state];
+        if (reachable == -1 || (acceptedPattern != -1 && reachable > acceptedPattern))
+        {
+            break;
+        }
+    }
+    return {acceptedPattern, acceptedEnd};
+}
+
+}
@@ -0,0 +1,72 @@
+#include "dansandu/glyph/internal/dfa.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/internal/nfa.hpp"
+
+#include <string_view>
+#include <vector>
+
+using dansandu::glyph::internal::dfa::Dfa;
+using dansandu::glyph::internal::dfa::getDfa;
+using dansandu::glyph::internal::nfa::getNfa;
+
+static int getAcceptedPattern(const Dfa& dfa, const std::string_view text)
+{
+    auto state = 0;
+    for (const auto character : text)
+    {
+        state = dfa.transitions[state * dfa.classesCount + dfa.byteClasses[static_cast<unsigned char>(character)]];
+        if (state == -1)
+        {
+            return -1;
+        }
+    }
+    return dfa.acceptedPatterns[state];
+}
+
+TEST_CASE("Dfa")
+{
+    const auto dfa = getDfa({getNfa("if"), getNfa("[a-z]+"), getNfa("[0-9]+"), getNfa("i[a-z]")});
+
+    SECTION("byte classes")
+    {
+        REQUIRE(dfa.classesCount == 5);
+
+        REQUIRE(dfa.byteClasses['a'] == dfa.byteClasses['z']);
+
+        REQUIRE(dfa.byteClasses['0'] == dfa.byteClasses['9']);
+
+        REQUIRE(dfa.byteClasses['i'] != dfa.byteClasses['f']);
+
+        REQUIRE(dfa.byteClasses['f'] != dfa.byteClasses['a']);
+
+        REQUIRE(dfa.byteClasses['+'] == dfa.byteClasses['\n']);
+    }
+
+    SECTION("accepted patterns")
+    {
+        REQUIRE(getAcceptedPattern(dfa, "") == -1);
+
+        REQUIRE(getAcceptedPattern(dfa, "if") == 0);
+
+        REQUIRE(getAcceptedPattern(dfa, "ix") == 1);
+
+        REQUIRE(getAcceptedPattern(dfa, "iff") == 1);
+
+        REQUIRE(getAcceptedPattern(dfa, "42") == 2);
+
+        REQUIRE(getAcceptedPattern(dfa, "4a") == -1);
+    }
+
+    SECTION("reachable patterns")
+    {
+        REQUIRE(dfa.reachablePatterns[0] == 0);
+
+        const auto afterDigit = dfa.transitions[dfa.byteClasses['7']];
+
+        REQUIRE(dfa.reachablePatterns[afterDigit] == 2);
+
+        const auto afterLetter = dfa.transitions[dfa.byteClasses['x']];
+
+        REQUIRE(dfa.reachablePatterns[afterLetter] == 1);
+    }
+}
@@ -0,0 +1,86 @@
+#include "dansandu/glyph/internal/digraph.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using dansandu::glyph::internal::symbol_set::SymbolSet;
+
+namespace dansandu::glyph::internal::digraph
+{
+
+void solveDigraph(const std::vector<std::vector<int>>& relation, std::vector<SymbolSet>& rows)
+{
+    struct Frame
+    {
+        int node;
+        int edge;
+        int depth;
+    };
+
+    const auto nodesCount = static_cast<int>(relation.size());
+    constexpr auto done = std::numeric_limits<int>::max();
+    auto depths = std::vector<int>(nodesCount, 0);
+    auto componentStack = std::vector<int>{};
+    auto callStack = std::vector<Frame>{};
+    const auto visit = [&depths, &componentStack, &callStack](const int node)
+    {
+        componentStack.push_back(node);
+        depths[node] = static_cast<int>(componentStack.size());
+        callStack.push_back({node, 0, depths[node]});
+    };
+
+    for (auto root = 0; root < nodesCount; ++root)
+    {
+        if (depths[root] != 0)
+        {
+            continue;
+        }
+        visit(root);
+        while (!callStack.empty())
+        {
+            auto& frame = callStack.back();
+            const auto node = frame.node;
+            if (frame.edge < static_cast<int>(relation[node].size()))
+            {
+                const auto next = relation[node][frame.edge++];
+                if (depths[next] == 0)
+                {
+                    visit(next);
+                }
+                else
+                {
+                    depths[node] = std::min(depths[node], depths[next]);
+                    rows[node] |= rows[next];
+                }
+                continue;
+            }
+
+            const auto depth = frame.depth;
+            callStack.pop_back();
+            if (depths[node] == depth)
+            {
+                while (true)
+                {
+                    const auto member = componentStack.back();
+                    componentStack.pop_back();
+                    depths[member] = done;
+                    if (member == node)
+                    {
+                        break;
+                    }
+                    rows[member] = rows[node];
+                }
+            }
+            if (!callStack.empty())
+            {
+                const auto parent = callStack.back().node;
+                depths[parent] = std::min(depths[parent], depths[node]);
+                rows[parent] |= rows[node];
+            }
+        }
+    }
+}
+
+}
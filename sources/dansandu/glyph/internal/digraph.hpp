@@ -0,0 +1,17 @@
+#pragma once
+
+#include "dansandu/glyph/internal/symbol_set.hpp"
+
+#include <vector>
+
+namespace dansandu::glyph::internal::digraph
+{
+
+// DeRemer and Pennello's digraph algorithm: each row becomes the union of its initial value and of the rows it relates
+// to. The rows of a strongly connected component are equal, so each component is solved once when its root is done,
+// which takes time proportional to the relation size times the row width. The traversal uses an explicit stack since
+// generated grammars can have very long relation chains.
+void solveDigraph(const std::vector<std::vector<int>>& relation,
+                  std::vector<dansandu::glyph::internal::symbol_set::SymbolSet>& rows);
+
+}
@@ -1,149 +1,140 @@
 #include "dansandu/glyph/internal/first_table.hpp"
-#include "dansandu/ballotin/container.hpp"
-#include "dansandu/ballotin/relation.hpp"
+#include "dansandu/glyph/internal/digraph.hpp"
 #include "dansandu/glyph/internal/grammar.hpp"
-#include "dansandu/glyph/internal/multimap.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
 #include "dansandu/glyph/symbol.hpp"
 
-using dansandu::ballotin::container::contains;
-using dansandu::ballotin::container::uniquePushBack;
-using dansandu::ballotin::relation::TotalOrder;
+#include <vector>
+
+using dansandu::glyph::internal::digraph::solveDigraph;
 using dansandu::glyph::internal::grammar::Grammar;
-using dansandu::glyph::internal::multimap::Multimap;
+using dansandu::glyph::internal::symbol_set::SymbolSet;
 using dansandu::glyph::symbol::Symbol;
 
 namespace dansandu::glyph::internal::first_table
 {
 
-struct PartialItem : TotalOrder<PartialItem>
+static std::vector<bool> getNullableSymbols(const Grammar& grammar)
 {
-    PartialItem(const int ruleIndex, const int position) : ruleIndex{ruleIndex}, position{position}
+    const auto& rules = grammar.getRules();
+    auto nullable = std::vector<bool>(grammar.getIdentifiers().size());
+    auto remainingSymbols = std::vector<int>(rules.size());
+    auto occurrences = std::vector<std::vector<int>>(grammar.getIdentifiers().size());
+    auto worklist = std::vector<Symbol>{};
+    for (auto ruleIndex = 0; ruleIndex < static_cast<int>(rules.size()); ++ruleIndex)
     {
+        const auto& rule = rules[ruleIndex];
+        remainingSymbols[ruleIndex] = static_cast<int>(rule.rightSide.size());
+        for (const auto symbol : rule.rightSide)
+        {
+            occurrences[symbol.getIdentifierIndex()].push_back(ruleIndex);
+        }
+        if (rule.rightSide.empty() && !nullable[rule.leftSide.getIdentifierIndex()])
+        {
+            nullable[rule.leftSide.getIdentifierIndex()] = true;
+            worklist.push_back(rule.leftSide);
+        }
     }
-
-    int ruleIndex;
-    int position;
-};
-
-inline bool operator<(const PartialItem a, const PartialItem b)
-{
-    return std::tie(a.ruleIndex, a.position) < std::tie(b.ruleIndex, b.position);
+    while (!worklist.empty())
+    {
+        const auto symbol = worklist.back();
+        worklist.pop_back();
+        for (const auto ruleIndex : occurrences[symbol.getIdentifierIndex()])
+        {
+            const auto leftSide = rules[ruleIndex].leftSide;
+            if (--remainingSymbols[ruleIndex] == 0 && !nullable[leftSide.getIdentifierIndex()])
+            {
+                nullable[leftSide.getIdentifierIndex()] = true;
+                worklist.push_back(leftSide);
+            }
+        }
+    }
+    return nullable;
 }
 
-std::vector<std::vector<Symbol>> getFirstTable(const Grammar& grammar)
+std::vector<SymbolSet> getFirstTable(const Grammar& grammar)
 {
-    auto firstTable = std::vector<std::vector<Symbol>>{grammar.getIdentifiers().size()};
-    auto partitions = Multimap{};
-
-    for (const auto& identifier : grammar.getIdentifiers())
+    const auto identifiersCount = static_cast<int>(grammar.getIdentifiers().size());
+    const auto nonTerminalsCount = grammar.getEndOfStringSymbol().getIdentifierIndex();
+    const auto nullable = getNullableSymbols(grammar);
+
+    // A nonterminal starts with the terminals and relates to the nonterminals that can begin one of its rules.
+    auto firstTable = std::vector<SymbolSet>(identifiersCount, SymbolSet{grammar});
+    auto relation = std::vector<std::vector<int>>(nonTerminalsCount);
+    for (const auto& rule : grammar.getRules())
     {
-        const auto symbol = grammar.getSymbol(identifier);
-        if (grammar.isTerminal(symbol))
+        const auto leftSide = rule.leftSide.getIdentifierIndex();
+        for (const auto symbol : rule.rightSide)
         {
-            partitions[symbol] = {symbol};
+            if (grammar.isTerminal(symbol))
+            {
+                firstTable[leftSide].insert(symbol);
+                break;
+            }
+            relation[leftSide].push_back(symbol.getIdentifierIndex());
+            if (!nullable[symbol.getIdentifierIndex()])
+            {
+                break;
+            }
         }
     }
 
-    auto blanks = std::vector<Symbol>{};
-    auto visitedRulesIndices = std::vector<int>{};
-
-    const auto& rules = grammar.getRules();
+    solveDigraph(relation, firstTable);
 
-    for (auto rootRuleIndex = 0; rootRuleIndex < static_cast<int>(rules.size()); ++rootRuleIndex)
+    for (auto index = 0; index < identifiersCount; ++index)
     {
-        if (contains(visitedRulesIndices, rootRuleIndex))
+        if (index >= nonTerminalsCount)
         {
-            continue;
+            firstTable[index].insert(Symbol{index});
         }
-
-        visitedRulesIndices.push_back(rootRuleIndex);
-
-        auto rulesIndicesPath = std::vector<int>{};
-        auto stack = std::vector<std::pair<PartialItem, int>>{{PartialItem{rootRuleIndex, 0}, -1}};
-
-        while (!stack.empty())
+        else if (nullable[index])
         {
-            const auto currentItem = stack.back().first;
-            if (currentItem.position == static_cast<int>(rules[currentItem.ruleIndex].rightSide.size()))
-            {
-                uniquePushBack(blanks, rules[currentItem.ruleIndex].leftSide);
-                stack.pop_back();
-                continue;
-            }
-
-            const auto currentSymbol = rules[currentItem.ruleIndex].rightSide[currentItem.position];
-            if (grammar.isTerminal(currentSymbol))
-            {
-                uniquePushBack(partitions[rules[currentItem.ruleIndex].leftSide], currentSymbol);
-                stack.pop_back();
-                continue;
-            }
-
-            const auto parentRuleIndex = stack.back().second;
-            while (!rulesIndicesPath.empty() && rulesIndicesPath.back() != parentRuleIndex)
-            {
-                rulesIndicesPath.pop_back();
-            }
-            rulesIndicesPath.push_back(currentItem.ruleIndex);
-            for (auto i = 0U; i < rulesIndicesPath.size(); ++i)
-            {
-                if (rules[rulesIndicesPath[i]].leftSide == currentSymbol)
-                {
-                    auto cycle = std::vector<Symbol>{};
-                    for (auto j = i; j < rulesIndicesPath.size(); ++j)
-                    {
-                        uniquePushBack(cycle, rules[rulesIndicesPath[j]].leftSide);
-                    }
-                    partitions.merge(cycle);
-                }
-            }
+            firstTable[index].insert(grammar.getEmptySymbol());
+        }
+    }
+    return firstTable;
+}
 
-            auto hasUnvisitedChildren = false;
-            for (auto ruleIndex = 0U; ruleIndex < rules.size(); ++ruleIndex)
+std::vector<SymbolSet> getFollowTable(const Grammar& grammar, const std::vector<SymbolSet>& firstTable)
+{
+    const auto identifiersCount = static_cast<int>(grammar.getIdentifiers().size());
+    const auto nonTerminalsCount = grammar.getEndOfStringSymbol().getIdentifierIndex();
+    const auto emptySymbol = grammar.getEmptySymbol();
+
+    // A nonterminal is followed by what can begin the rest of a rule and relates to the left side of the rules whose
+    // rest is nullable.
+    auto followTable = std::vector<SymbolSet>(identifiersCount, SymbolSet{grammar});
+    auto relation = std::vector<std::vector<int>>(nonTerminalsCount);
+    followTable[grammar.getStartSymbol().getIdentifierIndex()].insert(grammar.getEndOfStringSymbol());
+    for (const auto& rule : grammar.getRules())
+    {
+        auto suffixFirstSet = SymbolSet{grammar};
+        auto suffixNullable = true;
+        for (auto position = static_cast<int>(rule.rightSide.size()) - 1; position >= 0; --position)
+        {
+            const auto symbol = rule.rightSide[position];
+            if (grammar.isNonTerminal(symbol))
             {
-                if (rules[ruleIndex].leftSide == currentSymbol && !contains(visitedRulesIndices, ruleIndex))
+                followTable[symbol.getIdentifierIndex()] |= suffixFirstSet;
+                if (suffixNullable)
                 {
-                    hasUnvisitedChildren = true;
-                    stack.push_back({PartialItem{static_cast<int>(ruleIndex), 0}, currentItem.ruleIndex});
-                    visitedRulesIndices.push_back(ruleIndex);
+                    relation[symbol.getIdentifierIndex()].push_back(rule.leftSide.getIdentifierIndex());
                 }
             }
-            if (!hasUnvisitedChildren)
+            const auto& firstSet = firstTable[symbol.getIdentifierIndex()];
+            if (!firstSet.contains(emptySymbol))
             {
-                partitions[currentSymbol];
-                partitions[rules[currentItem.ruleIndex].leftSide];
-                const auto& firstSet = partitions[currentSymbol];
-                auto& target = partitions[rules[currentItem.ruleIndex].leftSide];
-                for (const auto& symbol : firstSet)
-                {
-                    uniquePushBack(target, symbol);
-                }
-                if (contains(blanks, currentSymbol))
-                {
-                    ++stack.back().first.position;
-                }
-                else
-                {
-                    stack.pop_back();
-                }
+                suffixFirstSet = SymbolSet{grammar};
+                suffixNullable = false;
             }
+            suffixFirstSet |= firstSet;
+            suffixFirstSet.erase(emptySymbol);
         }
     }
 
-    partitions.forEach(
-        [&firstTable](const auto& partition, const auto& firstSet)
-        {
-            for (const auto& symbol : partition)
-            {
-                firstTable[symbol.getIdentifierIndex()] = std::vector<Symbol>{firstSet.cbegin(), firstSet.cend()};
-            }
-        });
-    for (const auto& symbol : blanks)
-    {
-        firstTable[symbol.getIdentifierIndex()].push_back(grammar.getEmptySymbol());
-    }
+    solveDigraph(relation, followTable);
 
-    return firstTable;
+    return followTable;
 }
 
 }
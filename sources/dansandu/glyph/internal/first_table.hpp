@@ -1,14 +1,20 @@
 #pragma once
 
 #include "dansandu/glyph/internal/grammar.hpp"
-#include "dansandu/glyph/symbol.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
 
 #include <vector>
 
 namespace dansandu::glyph::internal::first_table
 {
 
-std::vector<std::vector<dansandu::glyph::symbol::Symbol>>
+std::vector<dansandu::glyph::internal::symbol_set::SymbolSet>
 getFirstTable(const dansandu::glyph::internal::grammar::Grammar& grammar);
 
+// Yields the terminals that can follow each nonterminal, including the end of string symbol. The rows of the terminals
+// are empty.
+std::vector<dansandu::glyph::internal::symbol_set::SymbolSet>
+getFollowTable(const dansandu::glyph::internal::grammar::Grammar& grammar,
+               const std::vector<dansandu::glyph::internal::symbol_set::SymbolSet>& firstTable);
+
 }
@@ -3,15 +3,19 @@
 #include "dansandu/ballotin/container.hpp"
 #include "dansandu/glyph/error.hpp"
 #include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
 #include "dansandu/glyph/symbol.hpp"
 
 #include <set>
+#include <string>
 #include <vector>
 
 using dansandu::glyph::error::GrammarError;
 using dansandu::glyph::internal::first_table::getFirstTable;
+using dansandu::glyph::internal::first_table::getFollowTable;
 using dansandu::glyph::internal::grammar::Grammar;
 using dansandu::glyph::internal::rule::Rule;
+using dansandu::glyph::internal::symbol_set::SymbolSet;
 using dansandu::glyph::symbol::Symbol;
 
 template<typename... Elements>
@@ -23,7 +27,8 @@ static std::set<Symbol> set(Elements&&... elements)
 // clang-format off
 TEST_CASE("first_table")
 {
-    auto firstTable = std::vector<std::vector<Symbol>>{};
+    auto firstTable = std::vector<SymbolSet>{};
+    auto followTable = std::vector<SymbolSet>{};
 
     const auto getFirstSet = [&firstTable](const auto symbol)
     {
@@ -31,6 +36,12 @@ TEST_CASE("first_table")
         return std::set<Symbol>{row.cbegin(), row.cend()};
     };
 
+    const auto getFollowSet = [&followTable](const auto symbol)
+    {
+        const auto& row = followTable.at(symbol.getIdentifierIndex());
+        return std::set<Symbol>{row.cbegin(), row.cend()};
+    };
+
     SECTION("grammar #1")
     {
         const auto text = R"(
@@ -147,6 +158,20 @@ TEST_CASE("first_table")
         REQUIRE(getFirstSet(empty) == set(empty));
 
         REQUIRE(getFirstSet(end) == set(end));
+
+        followTable = getFollowTable(grammar, firstTable);
+
+        REQUIRE(getFollowSet(Start) == set(end));
+
+        REQUIRE(getFollowSet(A) == set(a, b, c, d, end));
+
+        REQUIRE(getFollowSet(B) == set(a, c, d, end));
+
+        REQUIRE(getFollowSet(C) == set(a, c, d, end));
+
+        REQUIRE(getFollowSet(D) == set(a, c, d, end));
+
+        REQUIRE(getFollowSet(a).empty());
     }
 
     SECTION("grammar #3")
@@ -184,6 +209,14 @@ TEST_CASE("first_table")
         REQUIRE(getFirstSet(empty) == set(empty));
 
         REQUIRE(getFirstSet(end) == set(end));
+
+        followTable = getFollowTable(grammar, firstTable);
+
+        REQUIRE(getFollowSet(Start) == set(end));
+
+        REQUIRE(getFollowSet(A) == set(b, end));
+
+        REQUIRE(getFollowSet(B) == set(a));
     }
 
     SECTION("grammar #4")
@@ -308,5 +341,36 @@ TEST_CASE("first_table")
 
         REQUIRE(getFirstSet(end) == set(end));
     }
+
+    SECTION("long cycle")
+    {
+        auto text = std::string{"Start -> N0\n"};
+        for (auto index = 0; index < 5000; ++index)
+        {
+            const auto next = std::to_string((index + 1) % 5000);
+            text += "N" + std::to_string(index) + " -> N" + next + " t" + next + "\n";
+            text += "N" + std::to_string(index) + " -> t N" + next + "\n";
+        }
+        text += "N4999 -> t\n";
+
+        const auto grammar = Grammar{text};
+
+        const auto end = grammar.getSymbol("$");
+        const auto t   = grammar.getSymbol("t");
+
+        firstTable = getFirstTable(grammar);
+
+        REQUIRE(getFirstSet(grammar.getSymbol("N0")) == set(t));
+
+        REQUIRE(getFirstSet(grammar.getSymbol("N2500")) == set(t));
+
+        followTable = getFollowTable(grammar, firstTable);
+
+        REQUIRE(getFollowSet(grammar.getSymbol("N0")).size() == 5001);
+
+        REQUIRE(getFollowSet(grammar.getSymbol("N2500")) == getFollowSet(grammar.getSymbol("N0")));
+
+        REQUIRE(getFollowSet(grammar.getSymbol("N4999")).count(end) == 1);
+    }
 }
 // clang-format on
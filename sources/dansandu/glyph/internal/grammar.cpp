@@ -1,22 +1,18 @@
 #include "dansandu/glyph/internal/grammar.hpp"
-#include "dansandu/ballotin/container.hpp"
 #include "dansandu/ballotin/exception.hpp"
 #include "dansandu/ballotin/relation.hpp"
 #include "dansandu/ballotin/string.hpp"
 #include "dansandu/glyph/error.hpp"
-#include "dansandu/glyph/internal/multimap.hpp"
 
-#include <algorithm>
-#include <regex>
+#include <cctype>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
-using dansandu::ballotin::container::uniquePushBack;
 using dansandu::ballotin::string::format;
 using dansandu::ballotin::string::join;
-using dansandu::ballotin::string::split;
-using dansandu::ballotin::string::trim;
 using dansandu::glyph::error::GrammarError;
 using dansandu::glyph::internal::rule::Rule;
 using dansandu::glyph::symbol::Symbol;
@@ -24,144 +20,254 @@ using dansandu::glyph::symbol::Symbol;
 namespace dansandu::glyph::internal::grammar
 {
 
-template<typename T, typename U>
-auto find(const std::vector<T>& container, const U& value)
+struct ScannedRule
 {
-    return std::find(container.cbegin(), container.cend(), value);
-}
+    std::string_view leftSide;
+    std::vector<std::string_view> rightSide;
+    int lineNumber;
+};
 
-std::string removeComments(const std::string_view grammar)
+// Splits the grammar into production rules in a single pass over the text. Comments count as blanks and each rule is
+// an identifier, an arrow and zero or more blank separated identifiers on a single line.
+class GrammarScanner
 {
-    auto grammarWithoutComments = std::string{};
-
-    size_t offset = 0;
+public:
+    explicit GrammarScanner(const std::string_view text) : text_{text}, position_{0}, lineNumber_{1}, lineBegin_{0}
+    {
+    }
 
-    do
+    std::vector<ScannedRule> scan()
     {
-        auto commentStart = grammar.find("/*", offset);
-        if (commentStart != std::string::npos)
-        {
-            grammarWithoutComments += grammar.substr(offset, commentStart - offset);
-            offset = grammar.find("*/", commentStart) + 2;
-        }
-        else
+        auto rules = std::vector<ScannedRule>{};
+        while (true)
         {
-            grammarWithoutComments += grammar.substr(offset);
-            offset = std::string::npos;
+            skipBlanks();
+            if (atEnd())
+            {
+                break;
+            }
+            if (peek() == '\n')
+            {
+                startNewLine();
+                continue;
+            }
+            rules.push_back(scanRule());
         }
-    } while (offset != std::string::npos);
+        return rules;
+    }
 
-    return grammarWithoutComments;
-}
+private:
+    bool atEnd() const
+    {
+        return position_ == text_.size();
+    }
 
-Grammar::Grammar(const std::string_view grammar)
-{
-    static const auto productionRulePattern =
-        std::regex{R"( *[a-zA-Z0-9]+ *-> *(?:(?:[a-zA-Z0-9]+ +)*[a-zA-Z0-9]+ *)?)"};
+    char peek() const
+    {
+        return text_[position_];
+    }
 
-    const auto grammarWithoutComments = removeComments(grammar);
+    void startNewLine()
+    {
+        ++position_;
+        ++lineNumber_;
+        lineBegin_ = position_;
+    }
 
-    auto leftSideColumn = std::vector<std::string>{};
-    auto rightSideColumn = std::vector<std::vector<std::string>>{};
+    [[noreturn]] void fail(const char* const reason, const size_t position) const
+    {
+        THROW(GrammarError, reason, " at line ", lineNumber_, " and column ", position - lineBegin_ + 1);
+    }
 
-    for (const auto& line : split(grammarWithoutComments, "\n"))
+    void skipBlanks()
     {
-        const auto trimmedLine = trim(line);
-        if (trimmedLine.empty())
-        {
-            continue;
-        }
-        if (!std::regex_match(trimmedLine.cbegin(), trimmedLine.cend(), productionRulePattern))
+        while (!atEnd())
         {
-            THROW(GrammarError, "invalid production rule: ", trimmedLine);
-        }
-        const auto ruleTokens = split(trimmedLine, "->");
-        if (ruleTokens.size() == 2)
-        {
-            leftSideColumn.push_back(trim(ruleTokens[0]));
-
-            auto rightSide = std::vector<std::string>{};
-            for (const auto& identifier : split(ruleTokens[1], " "))
+            const auto character = peek();
+            if (character == ' ' || character == '\t' || character == '\r')
+            {
+                ++position_;
+            }
+            else if (text_.compare(position_, 2, "/*") == 0)
             {
-                auto trimmedIdentifier = trim(identifier);
-                if (trimmedIdentifier != "Start")
+                const auto commentEnd = text_.find("*/", position_ + 2);
+                if (commentEnd == std::string_view::npos)
                 {
-                    rightSide.push_back(std::move(trimmedIdentifier));
+                    fail("unterminated comment", position_);
                 }
-                else
+                for (position_ += 2; position_ < commentEnd;)
                 {
-                    THROW(GrammarError, "right side of production rule '", trimmedLine,
-                          "' cannot contain Start non-terminal");
+                    if (peek() == '\n')
+                    {
+                        startNewLine();
+                    }
+                    else
+                    {
+                        ++position_;
+                    }
                 }
+                position_ = commentEnd + 2;
             }
-            rightSideColumn.push_back(std::move(rightSide));
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    std::string_view scanIdentifier(const char* const expectation)
+    {
+        const auto begin = position_;
+        while (!atEnd() && std::isalnum(static_cast<unsigned char>(peek())))
+        {
+            ++position_;
+        }
+        if (position_ == begin)
+        {
+            fail(expectation, begin);
         }
-        else if (ruleTokens.size() == 1)
+        return text_.substr(begin, position_ - begin);
+    }
+
+    ScannedRule scanRule()
+    {
+        auto rule = ScannedRule{};
+        rule.lineNumber = lineNumber_;
+        rule.leftSide = scanIdentifier("expected the identifier of a nonterminal");
+        skipBlanks();
+        if (text_.compare(position_, 2, "->") != 0)
         {
-            leftSideColumn.push_back(trim(ruleTokens[0]));
-            rightSideColumn.push_back({});
+            fail("expected '->' after the left side of the production rule", position_);
         }
-        else
+        position_ += 2;
+        while (true)
         {
-            THROW(GrammarError, "ill-formed right side of production rule ", trimmedLine);
+            skipBlanks();
+            if (atEnd() || peek() == '\n')
+            {
+                break;
+            }
+            const auto begin = position_;
+            const auto identifier = scanIdentifier("expected an identifier or the end of the line");
+            if (identifier == "Start")
+            {
+                fail("right side of production rule cannot contain Start non-terminal", begin);
+            }
+            rule.rightSide.push_back(identifier);
         }
+        return rule;
     }
 
-    if (leftSideColumn.empty() || leftSideColumn.front() != "Start")
+    std::string_view text_;
+    size_t position_;
+    int lineNumber_;
+    size_t lineBegin_;
+};
+
+Grammar::Grammar(const std::string_view grammar)
+{
+    const auto scannedRules = GrammarScanner{grammar}.scan();
+
+    if (scannedRules.empty() || scannedRules.front().leftSide != "Start")
     {
         THROW(GrammarError, "the first production rule must be the start rule");
     }
 
-    for (auto i = 1U; i < leftSideColumn.size(); ++i)
+    for (auto i = 1U; i < scannedRules.size(); ++i)
     {
-        if (leftSideColumn[i] == "Start")
+        if (scannedRules[i].leftSide == "Start")
         {
-            THROW(GrammarError, "there can only be one start production rule");
+            THROW(GrammarError, "there can only be one start production rule, found another one at line ",
+                  scannedRules[i].lineNumber);
         }
     }
 
     // Insert nonterminals first.
-    identifiers_ = std::vector<std::string>{{"Start"}};
-    for (const auto& identifier : leftSideColumn)
+    identifierIndices_.reserve(scannedRules.size() + 2);
+    for (const auto& scannedRule : scannedRules)
     {
-        uniquePushBack(identifiers_, identifier);
+        addIdentifier(scannedRule.leftSide);
     }
 
     // Insert terminals next and mark the beginning of the terminals (end of string identifier).
     terminalBeginIndex_ = static_cast<int>(identifiers_.size());
-    identifiers_.push_back("$");
-    identifiers_.push_back("");
-    for (const auto& rightSide : rightSideColumn)
+    addIdentifier("$");
+    addIdentifier("");
+    rules_.reserve(scannedRules.size());
+    for (const auto& scannedRule : scannedRules)
     {
-        for (const auto& identifier : rightSide)
+        const auto leftSideSymbol = Symbol{addIdentifier(scannedRule.leftSide)};
+        auto rightSideSymbols = std::vector<Symbol>{};
+        rightSideSymbols.reserve(scannedRule.rightSide.size());
+        for (const auto identifier : scannedRule.rightSide)
         {
-            // Ensures two things in one search:
-            // 1. It's not a non-terminal (first part of the vector).
-            // 2. The terminal isn't a duplicate (second part of the vector).
-            uniquePushBack(identifiers_, identifier);
+            // Nonterminals are already indexed so only new terminals are added.
+            rightSideSymbols.push_back(Symbol{addIdentifier(identifier)});
         }
+        rules_.push_back({leftSideSymbol, std::move(rightSideSymbols)});
     }
 
-    for (auto ruleIndex = 0U; ruleIndex < leftSideColumn.size(); ++ruleIndex)
+    // Counting sort of the rules by left side which keeps the rules of each nonterminal in ascending order.
+    rulesByLeftSideBegin_.resize(terminalBeginIndex_ + 1);
+    for (const auto& rule : rules_)
     {
-        const auto identifierIndex =
-            static_cast<int>(find(identifiers_, leftSideColumn[ruleIndex]) - identifiers_.cbegin());
-        const auto leftSideSymbol = Symbol{identifierIndex};
-        auto rightSideSymbols = std::vector<Symbol>{};
-        for (const auto& identifier : rightSideColumn[ruleIndex])
-        {
-            const auto identifierIndex = static_cast<int>(find(identifiers_, identifier) - identifiers_.cbegin());
-            rightSideSymbols.push_back(Symbol{identifierIndex});
-        }
-        rules_.push_back({leftSideSymbol, std::move(rightSideSymbols)});
+        ++rulesByLeftSideBegin_[rule.leftSide.getIdentifierIndex() + 1];
+    }
+    for (auto index = 0; index < terminalBeginIndex_; ++index)
+    {
+        rulesByLeftSideBegin_[index + 1] += rulesByLeftSideBegin_[index];
+    }
+    rulesByLeftSide_.resize(rules_.size());
+    auto nextPositions = rulesByLeftSideBegin_;
+    for (auto ruleIndex = 0; ruleIndex < static_cast<int>(rules_.size()); ++ruleIndex)
+    {
+        rulesByLeftSide_[nextPositions[rules_[ruleIndex].leftSide.getIdentifierIndex()]++] = ruleIndex;
+    }
+
+    // The keys viewed the grammar text while interning and now view the final identifiers.
+    indexIdentifiers();
+}
+
+Grammar::Grammar(const Grammar& other)
+    : terminalBeginIndex_{other.terminalBeginIndex_},
+      identifiers_{other.identifiers_},
+      rules_{other.rules_},
+      rulesByLeftSide_{other.rulesByLeftSide_},
+      rulesByLeftSideBegin_{other.rulesByLeftSideBegin_}
+{
+    indexIdentifiers();
+}
+
+Grammar& Grammar::operator=(const Grammar& other)
+{
+    return *this = Grammar{other};
+}
+
+int Grammar::addIdentifier(const std::string_view identifier)
+{
+    const auto [position, inserted] = identifierIndices_.insert({identifier, static_cast<int>(identifiers_.size())});
+    if (inserted)
+    {
+        identifiers_.emplace_back(identifier);
+    }
+    return position->second;
+}
+
+void Grammar::indexIdentifiers()
+{
+    identifierIndices_.clear();
+    identifierIndices_.reserve(identifiers_.size());
+    for (auto index = 0; index < static_cast<int>(identifiers_.size()); ++index)
+    {
+        identifierIndices_.insert({identifiers_[index], index});
     }
 }
 
 Symbol Grammar::getSymbol(const std::string_view identifier) const
 {
-    if (const auto position = find(identifiers_, identifier); position != identifiers_.cend())
+    if (const auto position = identifierIndices_.find(identifier); position != identifierIndices_.cend())
     {
-        return Symbol{static_cast<int>(position - identifiers_.cbegin())};
+        return Symbol{position->second};
     }
     else
     {
@@ -172,11 +278,10 @@ Symbol Grammar::getSymbol(const std::string_view identifier) const
 
 Symbol Grammar::getTerminalSymbol(const std::string_view identifier) const
 {
-    if (const auto position =
-            std::find(identifiers_.cbegin() + terminalBeginIndex_ + 2, identifiers_.cend(), identifier);
-        position != identifiers_.cend())
+    if (const auto position = identifierIndices_.find(identifier);
+        position != identifierIndices_.cend() && position->second >= terminalBeginIndex_ + 2)
     {
-        return Symbol{static_cast<int>(position - identifiers_.cbegin())};
+        return Symbol{position->second};
     }
     else
     {
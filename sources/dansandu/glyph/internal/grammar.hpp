@@ -4,19 +4,55 @@
 #include "dansandu/glyph/symbol.hpp"
 
 #include <ostream>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace dansandu::glyph::internal::grammar
 {
 
-std::string removeComments(const std::string_view grammar);
+// Contiguous view over the indices of the rules sharing a left side, in ascending order.
+class RuleIndexRange
+{
+public:
+    RuleIndexRange(const int* const begin, const int* const end) : begin_{begin}, end_{end}
+    {
+    }
+
+    const int* begin() const
+    {
+        return begin_;
+    }
+
+    const int* end() const
+    {
+        return end_;
+    }
+
+    int size() const
+    {
+        return static_cast<int>(end_ - begin_);
+    }
+
+private:
+    const int* begin_;
+    const int* end_;
+};
 
 class Grammar
 {
 public:
     explicit Grammar(const std::string_view grammar);
 
+    Grammar(const Grammar& other);
+
+    Grammar(Grammar&& other) = default;
+
+    Grammar& operator=(const Grammar& other);
+
+    Grammar& operator=(Grammar&& other) = default;
+
     int getStartRuleIndex() const
     {
         return 0;
@@ -71,10 +107,31 @@ public:
         return rules_;
     }
 
+    // Yields the rules whose left side is the symbol, which is an empty range for terminals.
+    RuleIndexRange getRuleIndices(const dansandu::glyph::symbol::Symbol symbol) const
+    {
+        if (isTerminal(symbol))
+        {
+            return {nullptr, nullptr};
+        }
+        const auto data = rulesByLeftSide_.data();
+        const auto index = symbol.getIdentifierIndex();
+        return {data + rulesByLeftSideBegin_[index], data + rulesByLeftSideBegin_[index + 1]};
+    }
+
 private:
+    int addIdentifier(const std::string_view identifier);
+
+    void indexIdentifiers();
+
     int terminalBeginIndex_;
     std::vector<std::string> identifiers_;
+    // The keys view the strings of identifiers_ so lookups don't allocate. The index is rebuilt on copy, while a move
+    // keeps the strings in place.
+    std::unordered_map<std::string_view, int> identifierIndices_;
     std::vector<dansandu::glyph::internal::rule::Rule> rules_;
+    std::vector<int> rulesByLeftSide_;
+    std::vector<int> rulesByLeftSideBegin_;
 };
 
 }
@@ -6,43 +6,44 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <vector>
 
 using dansandu::glyph::error::GrammarError;
 using dansandu::glyph::internal::grammar::Grammar;
-using dansandu::glyph::internal::grammar::removeComments;
 using dansandu::glyph::internal::rule::Rule;
 using dansandu::glyph::symbol::Symbol;
 
-TEST_CASE("Grammar")
+static std::string getErrorMessage(const std::string_view grammar)
 {
-    SECTION("comment removal")
+    try
     {
-        REQUIRE(removeComments("") == "");
-
-        REQUIRE(removeComments("Not a comment") == "Not a comment");
-
-        REQUIRE(removeComments("/* comment */Not a comment") == "Not a comment");
-
-        REQUIRE(removeComments("Not a comment/* comment */") == "Not a comment");
+        Grammar{grammar};
+    }
+    catch (const GrammarError& error)
+    {
+        return error.what();
+    }
+    return {};
+}
 
-        REQUIRE(removeComments("Prefix/* comment */ */") == "Prefix */");
+TEST_CASE("Grammar")
+{
+    SECTION("comments and blanks")
+    {
+        const auto text = "/*0*/ Start\t-> A /* first rule */\r\n/*1*/ A -> a/* separator */b\r\n/*2*/ A ->/* empty */";
 
-        REQUIRE(removeComments("/* /* comment */Suffix") == "Suffix");
+        const auto grammar = Grammar{text};
 
-        const auto text = R"(
-            /*0*/ Start -> S      /* first production rule */
-            /*1*/ S     -> SS     /* some explanation */
-            /*2*/ SS    -> value  /* more details */
-        )";
+        const auto Start = grammar.getSymbol("Start");
+        const auto A = grammar.getSymbol("A");
+        const auto a = grammar.getSymbol("a");
+        const auto b = grammar.getSymbol("b");
 
-        const auto expected = R"(
-             Start -> S      
-             S     -> SS     
-             SS    -> value  
-        )";
+        REQUIRE(grammar.getRules() == std::vector<Rule>{Rule{Start, {A}}, Rule{A, {a, b}}, Rule{A, {}}});
 
-        REQUIRE(removeComments(text) == expected);
+        REQUIRE(getErrorMessage("Start -> a/* comment */\fb") ==
+                "expected an identifier or the end of the line at line 1 and column 24");
     }
 
     SECTION("invalid grammars")
@@ -66,6 +67,54 @@ TEST_CASE("Grammar")
         REQUIRE_THROWS_AS(Grammar{"Start -> Sums\nSums -> Start"}, GrammarError);
     }
 
+    SECTION("error locations")
+    {
+        REQUIRE(getErrorMessage("Start -> S\n  S -> a $ b") ==
+                "expected an identifier or the end of the line at line 2 and column 10");
+
+        REQUIRE(getErrorMessage("\nStart S") ==
+                "expected '->' after the left side of the production rule at line 2 and column 7");
+
+        REQUIRE(getErrorMessage("Start -> S\n/* multi\nline */ -> a") ==
+                "expected the identifier of a nonterminal at line 3 and column 9");
+
+        REQUIRE(getErrorMessage("Start -> S\nS -> a /* unterminated") == "unterminated comment at line 2 and column 8");
+
+        REQUIRE(getErrorMessage("Start -> S\nS -> a Start") ==
+                "right side of production rule cannot contain Start non-terminal at line 2 and column 8");
+
+        REQUIRE(getErrorMessage("Start -> S\nStart -> a") ==
+                "there can only be one start production rule, found another one at line 2");
+    }
+
+    SECTION("rule indices")
+    {
+        const auto grammar = Grammar{R"(
+            Start -> A
+            A     -> B a
+            B     -> b
+            A     -> a
+            B     ->
+            A     -> A B
+        )"};
+
+        const auto getRuleIndices = [&grammar](const std::string_view identifier)
+        {
+            const auto range = grammar.getRuleIndices(grammar.getSymbol(identifier));
+            return std::vector<int>{range.begin(), range.end()};
+        };
+
+        REQUIRE(getRuleIndices("Start") == std::vector<int>{0});
+
+        REQUIRE(getRuleIndices("A") == std::vector<int>{1, 3, 5});
+
+        REQUIRE(getRuleIndices("B") == std::vector<int>{2, 4});
+
+        REQUIRE(getRuleIndices("a").empty());
+
+        REQUIRE(getRuleIndices("$").empty());
+    }
+
     SECTION("grammar #1")
     {
         const auto text = R"(
@@ -381,4 +430,41 @@ TEST_CASE("Grammar")
             REQUIRE(grammar.getIdentifier(b) == "b");
         }
     }
+
+    SECTION("many terminals")
+    {
+        auto text = std::string{"Start -> List\nList -> List Item\nList -> Item\n"};
+        for (auto index = 0; index < 2000; ++index)
+        {
+            text += "Item -> t" + std::to_string(index) + " Item\nItem -> t" + std::to_string(index) + "\n";
+        }
+
+        const auto grammar = Grammar{text};
+
+        REQUIRE(grammar.getRules().size() == 4003);
+
+        REQUIRE(grammar.getSymbol("Item") == Symbol{2});
+
+        REQUIRE(grammar.getEndOfStringSymbol() == Symbol{3});
+
+        REQUIRE(grammar.getTerminalSymbol("t0") == Symbol{5});
+
+        REQUIRE(grammar.getTerminalSymbol("t1999") == Symbol{2004});
+
+        REQUIRE(grammar.getRules().back().rightSide == std::vector<Symbol>{Symbol{2004}});
+
+        REQUIRE_THROWS_AS(grammar.getTerminalSymbol("Item"), GrammarError);
+
+        REQUIRE_THROWS_AS(grammar.getSymbol("t2000"), GrammarError);
+
+        const auto copy = [&text]()
+        {
+            const auto original = Grammar{std::string{text}};
+            return Grammar{original};
+        }();
+
+        REQUIRE(copy.getTerminalSymbol("t1999") == Symbol{2004});
+
+        REQUIRE(copy.getSymbol("List") == Symbol{1});
+    }
 }
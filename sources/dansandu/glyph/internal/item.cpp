@@ -1,19 +1,63 @@
 #include "dansandu/glyph/internal/item.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <tuple>
+#include <vector>
+
+using dansandu::glyph::internal::symbol_set::hashCombine;
+using dansandu::glyph::internal::symbol_set::hashSeed;
 
 namespace dansandu::glyph::internal::item
 {
 
 bool operator<(const Item& left, const Item& right)
 {
-    return std::tie(left.ruleIndex, left.position, left.lookahead) <
-           std::tie(right.ruleIndex, right.position, right.lookahead);
+    return std::tie(left.ruleIndex, left.position, left.lookaheads) <
+           std::tie(right.ruleIndex, right.position, right.lookaheads);
 }
 
 std::ostream& operator<<(std::ostream& stream, const Item& item)
 {
-    return stream << "Item(" << item.ruleIndex << ", " << item.position << ", " << item.lookahead << ")";
+    return stream << "Item(" << item.ruleIndex << ", " << item.position << ", " << item.lookaheads << ")";
+}
+
+void mergeItems(std::vector<Item>& items)
+{
+    if (items.empty())
+    {
+        return;
+    }
+    std::sort(items.begin(), items.end());
+    auto merged = items.begin();
+    for (auto item = std::next(items.begin()); item != items.end(); ++item)
+    {
+        if (merged->hasSameCore(*item))
+        {
+            merged->lookaheads |= item->lookaheads;
+        }
+        else if (++merged != item)
+        {
+            *merged = std::move(*item);
+        }
+    }
+    items.erase(std::next(merged), items.end());
+}
+
+std::size_t ItemsHash::operator()(const std::vector<Item>& items) const
+{
+    auto hash = hashSeed;
+    for (const auto& item : items)
+    {
+        const auto value = (static_cast<std::uint64_t>(item.ruleIndex) << 40) ^
+                           (static_cast<std::uint64_t>(item.position) << 20) ^
+                           static_cast<std::uint64_t>(item.lookaheads.hash());
+        hash = hashCombine(hash, value);
+    }
+    return static_cast<std::size_t>(hash);
 }
 
 }
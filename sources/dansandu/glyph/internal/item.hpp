@@ -1,25 +1,46 @@
 #pragma once
 
 #include "dansandu/ballotin/relation.hpp"
-#include "dansandu/glyph/symbol.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+
+#include <cstddef>
+#include <ostream>
+#include <utility>
+#include <vector>
 
 namespace dansandu::glyph::internal::item
 {
 
+// An item is the core, a rule and the position of the dot within it, together with every lookahead the core has in a
+// state, so a state holds at most one item per core. The items of the LR(0) automaton have no lookaheads.
 struct Item : dansandu::ballotin::relation::TotalOrder<Item>
 {
-    Item(const int ruleIndex, const int position, const dansandu::glyph::symbol::Symbol lookahead)
-        : ruleIndex{ruleIndex}, position{position}, lookahead{lookahead}
+    Item(const int ruleIndex, const int position, dansandu::glyph::internal::symbol_set::SymbolSet lookaheads = {})
+        : ruleIndex{ruleIndex}, position{position}, lookaheads{std::move(lookaheads)}
+    {
+    }
+
+    bool hasSameCore(const Item& other) const
     {
+        return (ruleIndex == other.ruleIndex) & (position == other.position);
     }
 
     int ruleIndex;
     int position;
-    dansandu::glyph::symbol::Symbol lookahead;
+    dansandu::glyph::internal::symbol_set::SymbolSet lookaheads;
 };
 
 bool operator<(const Item& left, const Item& right);
 
 std::ostream& operator<<(std::ostream& stream, const Item& item);
 
+// Sorts the items and merges the lookaheads of the items with the same core.
+void mergeItems(std::vector<Item>& items);
+
+// Hashes a sorted list of items so that states can be looked up by their kernel.
+struct ItemsHash
+{
+    std::size_t operator()(const std::vector<Item>& items) const;
+};
+
 }
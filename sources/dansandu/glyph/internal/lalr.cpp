@@ -0,0 +1,142 @@
+#include "dansandu/glyph/internal/lalr.hpp"
+#include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/digraph.hpp"
+#include "dansandu/glyph/internal/first_table.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::internal::automaton::Automaton;
+using dansandu::glyph::internal::digraph::solveDigraph;
+using dansandu::glyph::internal::first_table::getFirstTable;
+using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::symbol_set::SymbolSet;
+using dansandu::glyph::symbol::Symbol;
+
+namespace dansandu::glyph::internal::lalr
+{
+
+struct Edge
+{
+    Symbol symbol;
+    int to;
+    int gotoIndex;
+};
+
+static const Edge& getEdge(const std::vector<Edge>& edges, const Symbol symbol)
+{
+    return *std::lower_bound(edges.cbegin(), edges.cend(), symbol,
+                             [](const Edge& edge, const Symbol value) { return edge.symbol < value; });
+}
+
+std::vector<std::vector<Reduction>> getLalr1Reductions(const Grammar& grammar, const Automaton& lr0Automaton)
+{
+    const auto statesCount = static_cast<int>(lr0Automaton.kernels.size());
+    const auto& rules = grammar.getRules();
+    const auto firstTable = getFirstTable(grammar);
+    const auto isNullable = [&grammar, &firstTable](const Symbol symbol)
+    { return firstTable[symbol.getIdentifierIndex()].contains(grammar.getEmptySymbol()); };
+
+    // The nonterminal transitions, or gotos, are the nodes of the relations.
+    auto edges = std::vector<std::vector<Edge>>(statesCount);
+    auto gotos = std::vector<std::pair<int, Symbol>>{};
+    for (const auto& transition : lr0Automaton.transitions)
+    {
+        auto gotoIndex = -1;
+        if (grammar.isNonTerminal(transition.symbol))
+        {
+            gotoIndex = static_cast<int>(gotos.size());
+            gotos.push_back({transition.from, transition.symbol});
+        }
+        edges[transition.from].push_back({transition.symbol, transition.to, gotoIndex});
+    }
+    for (auto& stateEdges : edges)
+    {
+        std::sort(stateEdges.begin(), stateEdges.end(),
+                  [](const Edge& left, const Edge& right) { return left.symbol < right.symbol; });
+    }
+
+    // A goto directly reads the terminals shifted from its target state and reads what the nullable gotos leaving
+    // its target state read.
+    const auto gotosCount = static_cast<int>(gotos.size());
+    auto rows = std::vector<SymbolSet>(gotosCount, SymbolSet{grammar});
+    auto reads = std::vector<std::vector<int>>(gotosCount);
+    for (auto gotoIndex = 0; gotoIndex < gotosCount; ++gotoIndex)
+    {
+        const auto [from, symbol] = gotos[gotoIndex];
+        const auto target = getEdge(edges[from], symbol).to;
+        for (const auto& edge : edges[target])
+        {
+            if (grammar.isTerminal(edge.symbol))
+            {
+                rows[gotoIndex].insert(edge.symbol);
+            }
+            else if (isNullable(edge.symbol))
+            {
+                reads[gotoIndex].push_back(edge.gotoIndex);
+            }
+        }
+        if (target == lr0Automaton.finalStateIndex)
+        {
+            rows[gotoIndex].insert(grammar.getEndOfStringSymbol());
+        }
+    }
+
+    solveDigraph(reads, rows);
+
+    // Walking each rule of the goto's nonterminal from the goto's state finds the gotos that include it, those on
+    // nonterminals followed by a nullable rest of the rule, and the state where the rule is reduced.
+    auto includes = std::vector<std::vector<int>>(gotosCount);
+    auto lookbacks = std::vector<std::vector<std::pair<int, int>>>(statesCount);
+    auto nullableSuffixes = std::vector<bool>{};
+    for (auto gotoIndex = 0; gotoIndex < gotosCount; ++gotoIndex)
+    {
+        const auto [from, symbol] = gotos[gotoIndex];
+        for (const auto ruleIndex : grammar.getRuleIndices(symbol))
+        {
+            const auto& rightSide = rules[ruleIndex].rightSide;
+            const auto rightSideSize = static_cast<int>(rightSide.size());
+            nullableSuffixes.assign(rightSideSize + 1, true);
+            for (auto position = rightSideSize - 1; position >= 0; --position)
+            {
+                nullableSuffixes[position] = nullableSuffixes[position + 1] && isNullable(rightSide[position]);
+            }
+            auto state = from;
+            for (auto position = 0; position < rightSideSize; ++position)
+            {
+                const auto& edge = getEdge(edges[state], rightSide[position]);
+                if (edge.gotoIndex != -1 && nullableSuffixes[position + 1])
+                {
+                    includes[edge.gotoIndex].push_back(gotoIndex);
+                }
+                state = edge.to;
+            }
+            lookbacks[state].push_back({ruleIndex, gotoIndex});
+        }
+    }
+
+    solveDigraph(includes, rows);
+
+    auto reductions = std::vector<std::vector<Reduction>>(statesCount);
+    for (auto stateIndex = 0; stateIndex < statesCount; ++stateIndex)
+    {
+        auto& stateLookbacks = lookbacks[stateIndex];
+        std::sort(stateLookbacks.begin(), stateLookbacks.end());
+        for (const auto& [ruleIndex, gotoIndex] : stateLookbacks)
+        {
+            auto& stateReductions = reductions[stateIndex];
+            if (stateReductions.empty() || stateReductions.back().ruleIndex != ruleIndex)
+            {
+                stateReductions.push_back({ruleIndex, SymbolSet{grammar}});
+            }
+            stateReductions.back().lookaheads |= rows[gotoIndex];
+        }
+    }
+    return reductions;
+}
+
+}
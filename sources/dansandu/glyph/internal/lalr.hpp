@@ -0,0 +1,25 @@
+#pragma once
+
+#include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+
+#include <vector>
+
+namespace dansandu::glyph::internal::lalr
+{
+
+struct Reduction
+{
+    int ruleIndex;
+    dansandu::glyph::internal::symbol_set::SymbolSet lookaheads;
+};
+
+// Yields for each state of the LR(0) automaton the rules it reduces, in ascending order, and their LALR(1) lookaheads.
+// The lookaheads are computed with DeRemer and Pennello's relations over the nonterminal transitions, so the canonical
+// LR(1) automaton is never built. The start rule is left out since the final state accepts instead of reducing it.
+std::vector<std::vector<Reduction>>
+getLalr1Reductions(const dansandu::glyph::internal::grammar::Grammar& grammar,
+                   const dansandu::glyph::internal::automaton::Automaton& lr0Automaton);
+
+}
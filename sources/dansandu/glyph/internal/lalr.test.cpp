@@ -0,0 +1,109 @@
+#include "dansandu/glyph/internal/lalr.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+using dansandu::glyph::internal::automaton::getAutomaton;
+using dansandu::glyph::internal::automaton::getLr0Automaton;
+using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::lalr::getLalr1Reductions;
+using dansandu::glyph::symbol::Symbol;
+
+// clang-format off
+TEST_CASE("LALR(1)")
+{
+    SECTION("nullable and left recursive rules")
+    {
+        const auto grammar = Grammar{R"(
+            Start -> List
+            List  -> List Item
+            List  ->
+            Item  -> a Tail
+            Tail  -> b
+            Tail  ->
+        )"};
+
+        const auto end = grammar.getSymbol("$");
+        const auto a   = grammar.getSymbol("a");
+        const auto b   = grammar.getSymbol("b");
+
+        const auto automaton = getLr0Automaton(grammar);
+        const auto reductions = getLalr1Reductions(grammar, automaton);
+
+        REQUIRE(automaton.kernels.size() == 6);
+
+        REQUIRE(reductions.size() == automaton.kernels.size());
+
+        REQUIRE(reductions[0].size() == 1);
+
+        REQUIRE(reductions[0][0].ruleIndex == 2);
+
+        REQUIRE(reductions[0][0].lookaheads.getSymbols() == std::vector<Symbol>{end, a});
+
+        REQUIRE(reductions[1].empty());
+
+        auto tailReductions = 0;
+        for (const auto& stateReductions : reductions)
+        {
+            for (const auto& reduction : stateReductions)
+            {
+                if (reduction.ruleIndex == 4 || reduction.ruleIndex == 5)
+                {
+                    REQUIRE(reduction.lookaheads.getSymbols() == std::vector<Symbol>{end, a});
+                    ++tailReductions;
+                }
+                else
+                {
+                    REQUIRE(!reduction.lookaheads.contains(b));
+                }
+            }
+        }
+
+        REQUIRE(tailReductions == 2);
+    }
+
+    SECTION("LR(1) grammar that isn't LALR(1)")
+    {
+        const auto grammar = Grammar{R"(
+            Start -> S
+            S -> a E c
+            S -> a F d
+            S -> b F c
+            S -> b E d
+            E -> e
+            F -> e
+        )"};
+
+        const auto c = grammar.getSymbol("c");
+        const auto d = grammar.getSymbol("d");
+
+        const auto automaton = getLr0Automaton(grammar);
+        const auto reductions = getLalr1Reductions(grammar, automaton);
+
+        REQUIRE(automaton.kernels.size() < getAutomaton(grammar).kernels.size());
+
+        auto merged = 0;
+        for (const auto& stateReductions : reductions)
+        {
+            if (stateReductions.size() == 2)
+            {
+                REQUIRE(stateReductions[0].ruleIndex == 5);
+
+                REQUIRE(stateReductions[1].ruleIndex == 6);
+
+                REQUIRE(stateReductions[0].lookaheads.getSymbols() == std::vector<Symbol>{c, d});
+
+                REQUIRE(stateReductions[1].lookaheads.getSymbols() == std::vector<Symbol>{c, d});
+
+                ++merged;
+            }
+        }
+
+        REQUIRE(merged == 1);
+    }
+}
+// clang-format on
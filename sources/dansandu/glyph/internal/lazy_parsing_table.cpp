@@ -0,0 +1,170 @@
+#include "dansandu/glyph/internal/lazy_parsing_table.hpp"
+#include "dansandu/ballotin/exception.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/first_table.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/item.hpp"
+#include "dansandu/glyph/internal/parsing_table.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::error::GrammarError;
+using dansandu::glyph::internal::automaton::getClosureTemplates;
+using dansandu::glyph::internal::automaton::getStateClosure;
+using dansandu::glyph::internal::automaton::getStateTransitions;
+using dansandu::glyph::internal::automaton::isFinalState;
+using dansandu::glyph::internal::first_table::getFirstTable;
+using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::item::Item;
+using dansandu::glyph::internal::parsing_table::Action;
+using dansandu::glyph::internal::parsing_table::Cell;
+using dansandu::glyph::internal::symbol_set::SymbolSet;
+using dansandu::glyph::symbol::Symbol;
+
+namespace dansandu::glyph::internal::lazy_parsing_table
+{
+
+static std::vector<Item> getStartKernel(const Grammar& grammar)
+{
+    auto lookaheads = SymbolSet{grammar};
+    lookaheads.insert(grammar.getEndOfStringSymbol());
+    return {Item{grammar.getStartRuleIndex(), 0, std::move(lookaheads)}};
+}
+
+LazyParsingTable::LazyParsingTable(const Grammar& grammar)
+    : grammar_{grammar},
+      firstTable_{getFirstTable(grammar)},
+      closureTemplates_{getClosureTemplates(grammar, firstTable_)},
+      finalStateIndex_{-1}
+{
+    // The rows along the start rule are built right away so that the final state is validated as eagerly as it is
+    // for the other construction modes.
+    auto stateIndex = addState(getStartKernel(grammar));
+    for (const auto symbol : grammar.getRules()[grammar.getStartRuleIndex()].rightSide)
+    {
+        stateIndex = computeRow(stateIndex).cells[symbol.getIdentifierIndex()].parameter;
+    }
+    if (finalStateIndex_ == -1 || stateIndex != finalStateIndex_)
+    {
+        THROW(GrammarError, "no final state was found");
+    }
+}
+
+const Row& LazyParsingTable::getRow(const int stateIndex) const
+{
+    const auto lock = std::lock_guard<std::mutex>{mutex_};
+    if (stateIndex < 0 || stateIndex >= static_cast<int>(rows_.size()))
+    {
+        THROW(std::out_of_range, "state ", stateIndex, " wasn't reached yet");
+    }
+    return computeRow(stateIndex);
+}
+
+int LazyParsingTable::addState(std::vector<Item> kernel) const
+{
+    const auto [position, inserted] = stateIndices_.try_emplace(kernel, static_cast<int>(kernels_.size()));
+    if (!inserted)
+    {
+        return position->second;
+    }
+    const auto stateIndex = position->second;
+    const auto final = isFinalState(kernel, grammar_);
+    kernels_.push_back(std::move(kernel));
+    rows_.emplace_back();
+    if (final)
+    {
+        if (finalStateIndex_ != -1)
+        {
+            THROW(GrammarError, "multiple final states found with indices ", stateIndex, " and ", finalStateIndex_);
+        }
+        finalStateIndex_ = stateIndex;
+    }
+    return stateIndex;
+}
+
+const Row& LazyParsingTable::computeRow(const int stateIndex) const
+{
+    if (rows_[stateIndex])
+    {
+        return *rows_[stateIndex];
+    }
+
+    auto row = std::make_unique<Row>();
+    row->cells.resize(grammar_.getIdentifiers().size());
+    const auto closure = getStateClosure(kernels_[stateIndex], grammar_, firstTable_, closureTemplates_);
+    for (auto& [symbol, kernel] : getStateTransitions(closure, grammar_))
+    {
+        std::sort(kernel.begin(), kernel.end());
+        const auto action = grammar_.isTerminal(symbol) ? Action::shift : Action::goTo;
+        row->cells[symbol.getIdentifierIndex()] = Cell{action, addState(std::move(kernel))};
+    }
+    const auto& rules = grammar_.getRules();
+    for (const auto& item : closure)
+    {
+        if (item.position != static_cast<int>(rules[item.ruleIndex].rightSide.size()))
+        {
+            continue;
+        }
+        for (const auto lookahead : item.lookaheads)
+        {
+            auto& cell = row->cells[lookahead.getIdentifierIndex()];
+            if (cell.action != Action::error)
+            {
+                THROW(std::logic_error, "grammar cannot be parsed using a CLR(1) parser due to ", cell.action,
+                      "/reduce conflict on symbol '", grammar_.getIdentifier(lookahead), "'");
+            }
+            cell = Cell{Action::reduce, item.ruleIndex};
+        }
+    }
+    if (stateIndex == finalStateIndex_)
+    {
+        row->cells[grammar_.getEndOfStringSymbol().getIdentifierIndex()] =
+            Cell{Action::accept, grammar_.getStartRuleIndex()};
+    }
+    row->expectedSymbols.push_back(grammar_.getDiscardedSymbolPlaceholder());
+    auto consistent = true;
+    for (auto symbolIndex = grammar_.getEndOfStringSymbol().getIdentifierIndex();
+         symbolIndex < static_cast<int>(row->cells.size()); ++symbolIndex)
+    {
+        const auto cell = row->cells[symbolIndex];
+        if (cell.action == Action::error)
+        {
+            continue;
+        }
+        row->expectedSymbols.push_back(Symbol{symbolIndex});
+        if (cell.action != Action::reduce ||
+            (row->defaultReduction.action == Action::reduce && row->defaultReduction != cell))
+        {
+            consistent = false;
+        }
+        row->defaultReduction = cell;
+    }
+    if (!consistent)
+    {
+        row->defaultReduction = Cell{};
+    }
+    else if (row->defaultReduction.action == Action::reduce)
+    {
+        row->expectedSymbols.clear();
+        row->expectedSymbols.shrink_to_fit();
+    }
+    rows_[stateIndex] = std::move(row);
+    return *rows_[stateIndex];
+}
+
+int LazyParsingTable::getComputedRowsCount() const
+{
+    const auto lock = std::lock_guard<std::mutex>{mutex_};
+    return static_cast<int>(
+        std::count_if(rows_.cbegin(), rows_.cend(), [](const auto& row) { return row != nullptr; }));
+}
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/item.hpp"
+#include "dansandu/glyph/internal/parsing_table.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace dansandu::glyph::internal::lazy_parsing_table
+{
+
+// The cells of a state indexed by symbol, the expected symbols of the state, as listed by getExpectedSymbols, and its
+// default reduction, as given by getDefaultReductions. States with a default reduction have no expected symbols since
+// they never read the next token.
+struct Row
+{
+    std::vector<dansandu::glyph::internal::parsing_table::Cell> cells;
+    std::vector<dansandu::glyph::symbol::Symbol> expectedSymbols;
+    dansandu::glyph::internal::parsing_table::Cell defaultReduction;
+};
+
+// Canonical LR(1) table whose rows are computed the first time their state is reached, together with the kernels of
+// the states their transitions lead to, so only the states a parse goes through are ever built. States are numbered in
+// the order they are discovered. Rows are never modified once computed and can be read from several threads while
+// other rows are being computed. The rows along the start rule are built with the table, so a missing or ambiguous
+// final state is reported by the constructor as it is for the eager tables, while other conflicts are only found once
+// a conflicting state is reached. The grammar has to outlive the table.
+class LazyParsingTable
+{
+public:
+    explicit LazyParsingTable(const dansandu::glyph::internal::grammar::Grammar& grammar);
+
+    LazyParsingTable(const LazyParsingTable&) = delete;
+
+    LazyParsingTable& operator=(const LazyParsingTable&) = delete;
+
+    // Yields the row of a state already reached through the rows computed so far, starting with state 0.
+    const Row& getRow(const int stateIndex) const;
+
+    int getComputedRowsCount() const;
+
+private:
+    int addState(std::vector<dansandu::glyph::internal::item::Item> kernel) const;
+
+    const Row& computeRow(const int stateIndex) const;
+
+    const dansandu::glyph::internal::grammar::Grammar& grammar_;
+    std::vector<dansandu::glyph::internal::symbol_set::SymbolSet> firstTable_;
+    std::vector<std::vector<dansandu::glyph::internal::automaton::ClosureEntry>> closureTemplates_;
+    mutable std::mutex mutex_;
+    mutable int finalStateIndex_;
+    mutable std::vector<std::vector<dansandu::glyph::internal::item::Item>> kernels_;
+    mutable std::unordered_map<std::vector<dansandu::glyph::internal::item::Item>, int,
+                               dansandu::glyph::internal::item::ItemsHash>
+        stateIndices_;
+    mutable std::vector<std::unique_ptr<const Row>> rows_;
+};
+
+}
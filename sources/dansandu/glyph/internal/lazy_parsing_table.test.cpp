@@ -0,0 +1,170 @@
+#include "dansandu/glyph/internal/lazy_parsing_table.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/parsing.hpp"
+#include "dansandu/glyph/internal/parsing_table.hpp"
+#include "dansandu/glyph/node.hpp"
+#include "dansandu/glyph/regex_tokenizer.hpp"
+#include "dansandu/glyph/tokenizer.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using dansandu::glyph::error::SyntaxError;
+using dansandu::glyph::internal::automaton::getAutomaton;
+using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::lazy_parsing_table::LazyParsingTable;
+using dansandu::glyph::internal::parsing::parse;
+using dansandu::glyph::internal::parsing_table::getClr1ParsingTable;
+using dansandu::glyph::internal::parsing_table::getExpectedSymbols;
+using dansandu::glyph::node::Node;
+using dansandu::glyph::regex_tokenizer::RegexTokenizer;
+using dansandu::glyph::tokenizer::TokenViewStream;
+
+TEST_CASE("Lazy parsing table")
+{
+    const auto grammar = Grammar{R"(
+        /*0*/ Start       -> Sums
+        /*1*/ Sums        -> Sums plus Products
+        /*2*/ Sums        -> Products
+        /*3*/ Products    -> Products multiply SignedValue
+        /*4*/ Products    -> SignedValue
+        /*5*/ SignedValue -> Value
+        /*6*/ SignedValue -> minus Value
+        /*7*/ Value       -> number
+        /*8*/ Value       -> identifier
+        /*9*/ Value       -> open Sums close
+    )"};
+
+    const auto tokenizer = RegexTokenizer{{{grammar.getSymbol("identifier"), "[a-z]\\w*"},
+                                           {grammar.getSymbol("number"), "\\d+"},
+                                           {grammar.getSymbol("plus"), "\\+"},
+                                           {grammar.getSymbol("minus"), "-"},
+                                           {grammar.getSymbol("multiply"), "\\*"},
+                                           {grammar.getSymbol("open"), "\\("},
+                                           {grammar.getSymbol("close"), "\\)"},
+                                           {grammar.getDiscardedSymbolPlaceholder(), "\\s+"}}};
+
+    const auto parsingTable = getClr1ParsingTable(grammar, getAutomaton(grammar));
+    const auto expectedSymbols = getExpectedSymbols(grammar, parsingTable);
+    const auto statesCount = static_cast<int>(parsingTable.front().size());
+
+    const auto parseLazily = [&grammar, &tokenizer](const std::string& text, const LazyParsingTable& lazyTable)
+    {
+        const auto tokens = tokenizer.tokenize(text);
+        auto tokenStream = TokenViewStream{tokens};
+        return parse(text, tokenStream, lazyTable, grammar);
+    };
+
+    const auto parseEagerly = [&grammar, &tokenizer, &parsingTable, &expectedSymbols](const std::string& text)
+    {
+        const auto tokens = tokenizer.tokenize(text);
+        auto tokenStream = TokenViewStream{tokens};
+        return parse(text, tokenStream, parsingTable, expectedSymbols, grammar);
+    };
+
+    SECTION("rows are computed on demand")
+    {
+        const auto lazyTable = LazyParsingTable{grammar};
+
+        REQUIRE(lazyTable.getComputedRowsCount() == 1);
+
+        const auto text = std::string{"a * b + 10"};
+
+        REQUIRE(parseLazily(text, lazyTable) == parseEagerly(text));
+
+        const auto computedRowsCount = lazyTable.getComputedRowsCount();
+
+        REQUIRE(computedRowsCount > 0);
+
+        REQUIRE(computedRowsCount < statesCount);
+
+        REQUIRE(parseLazily(text, lazyTable) == parseEagerly(text));
+
+        REQUIRE(lazyTable.getComputedRowsCount() == computedRowsCount);
+
+        const auto nested = std::string{"-(a + (b * 3)) * (1 + -c)"};
+
+        REQUIRE(parseLazily(nested, lazyTable) == parseEagerly(nested));
+
+        REQUIRE(lazyTable.getComputedRowsCount() > computedRowsCount);
+
+        REQUIRE(lazyTable.getComputedRowsCount() <= statesCount);
+
+        REQUIRE_THROWS_AS(lazyTable.getRow(statesCount + 1), std::out_of_range);
+    }
+
+    SECTION("syntax errors")
+    {
+        const auto lazyTable = LazyParsingTable{grammar};
+
+        for (const auto text : {"a *", "* 2", "(a + b", "x y", ""})
+        {
+            REQUIRE_THROWS_AS(parseLazily(text, lazyTable), SyntaxError);
+        }
+    }
+
+    SECTION("conflicts are found once reached")
+    {
+        const auto ambiguous = Grammar{R"(
+            Start -> Sums
+            Sums  -> Sums plus Sums
+            Sums  -> number
+        )"};
+
+        const auto lazyTable = LazyParsingTable{ambiguous};
+
+        REQUIRE_NOTHROW(lazyTable.getRow(0));
+
+        const auto ambiguousTokenizer = RegexTokenizer{{{ambiguous.getSymbol("number"), "\\d+"},
+                                                        {ambiguous.getSymbol("plus"), "\\+"}}};
+
+        const auto text = std::string{"1+2+3"};
+        const auto tokens = ambiguousTokenizer.tokenize(text);
+        auto tokenStream = TokenViewStream{tokens};
+
+        REQUIRE_THROWS_AS(parse(text, tokenStream, lazyTable, ambiguous), std::logic_error);
+    }
+
+    SECTION("conflicts along the start rule are found at construction")
+    {
+        const auto conflicting = Grammar{R"(
+            Start -> A b
+            A     ->
+            A     -> C
+            C     ->
+        )"};
+
+        REQUIRE_THROWS_AS(getClr1ParsingTable(conflicting, getAutomaton(conflicting)), std::logic_error);
+
+        REQUIRE_THROWS_AS(LazyParsingTable{conflicting}, std::logic_error);
+    }
+
+    SECTION("concurrent parsing")
+    {
+        const auto lazyTable = LazyParsingTable{grammar};
+
+        const auto texts = std::vector<std::string>{"a * b + 10", "-(a + (b * 3)) * (1 + -c)", "((x))", "1 + 2 * -3"};
+
+        auto results = std::vector<std::vector<Node>>(texts.size());
+        auto threads = std::vector<std::thread>{};
+        for (auto index = 0; index < static_cast<int>(texts.size()); ++index)
+        {
+            threads.emplace_back([&parseLazily, &texts, &results, &lazyTable, index]()
+                                 { results[index] = parseLazily(texts[index], lazyTable); });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (auto index = 0; index < static_cast<int>(texts.size()); ++index)
+        {
+            REQUIRE(results[index] == parseEagerly(texts[index]));
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#include "dansandu/glyph/internal/literal_trie.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dansandu::glyph::internal::literal_trie
+{
+
+LiteralTrie::LiteralTrie() : nodes_{1}
+{
+}
+
+void LiteralTrie::insert(const std::string_view literal, const int value)
+{
+    auto nodeIndex = 0;
+    for (const auto character : literal)
+    {
+        const auto byte = static_cast<unsigned char>(character);
+        auto& children = nodes_[nodeIndex].children;
+        const auto position = std::lower_bound(children.begin(), children.end(), byte,
+                                               [](const auto& child, const auto key) { return child.first < key; });
+        if (position != children.end() && position->first == byte)
+        {
+            nodeIndex = position->second;
+        }
+        else
+        {
+            const auto childIndex = static_cast<int>(nodes_.size());
+            children.insert(position, {byte, childIndex});
+            nodes_.emplace_back();
+            nodeIndex = childIndex;
+        }
+    }
+    nodes_[nodeIndex].values.push_back(value);
+}
+
+int LiteralTrie::getChild(const int nodeIndex, const unsigned char character) const
+{
+    const auto& children = nodes_[nodeIndex].children;
+    const auto position = std::lower_bound(children.cbegin(), children.cend(), character,
+                                           [](const auto& child, const auto key) { return child.first < key; });
+    return position != children.cend() && position->first == character ? position->second : -1;
+}
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dansandu::glyph::internal::literal_trie
+{
+
+class LiteralTrie
+{
+public:
+    LiteralTrie();
+
+    void insert(const std::string_view literal, const int value);
+
+    // Invokes the lambda with the value and the length of every inserted literal found at the given text position,
+    // shortest literals first. Values of the same literal are passed in insertion order.
+    template<typename Lambda>
+    void forEachMatch(const std::string_view text, const std::int64_t position, Lambda&& lambda) const
+    {
+        auto nodeIndex = 0;
+        auto current = position;
+        while (true)
+        {
+            for (const auto value : nodes_[nodeIndex].values)
+            {
+                lambda(value, static_cast<int>(current - position));
+            }
+            if (current == static_cast<std::int64_t>(text.size()))
+            {
+                break;
+            }
+            nodeIndex = getChild(nodeIndex, static_cast<unsigned char>(text[current]));
+            if (nodeIndex == -1)
+            {
+                break;
+            }
+            ++current;
+        }
+    }
+
+private:
+    struct Node
+    {
+        std::vector<std::pair<unsigned char, int>> children;
+        std::vector<int> values;
+    };
+
+    int getChild(const int nodeIndex, const unsigned char character) const;
+
+    std::vector<Node> nodes_;
+};
+
+}
@@ -0,0 +1,49 @@
+#include "dansandu/glyph/internal/literal_trie.hpp"
+#include "catchorg/catch/catch.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::internal::literal_trie::LiteralTrie;
+
+using Matches = std::vector<std::pair<int, int>>;
+
+static Matches getMatches(const LiteralTrie& trie, const std::string_view text, const std::int64_t position)
+{
+    auto matches = Matches{};
+    trie.forEachMatch(text, position, [&matches](const int value, const int length)
+                      { matches.push_back({value, length}); });
+    return matches;
+}
+
+TEST_CASE("LiteralTrie")
+{
+    auto trie = LiteralTrie{};
+
+    trie.insert("+", 0);
+    trie.insert("++", 1);
+    trie.insert("select", 2);
+    trie.insert("sel", 3);
+    trie.insert("+", 4);
+
+    SECTION("no match")
+    {
+        REQUIRE(getMatches(trie, "", 0).empty());
+
+        REQUIRE(getMatches(trie, "-+", 0).empty());
+
+        REQUIRE(getMatches(trie, "se", 0).empty());
+    }
+
+    SECTION("matches")
+    {
+        REQUIRE(getMatches(trie, "+++", 0) == Matches{{0, 1}, {4, 1}, {1, 2}});
+
+        REQUIRE(getMatches(trie, "a+", 1) == Matches{{0, 1}, {4, 1}});
+
+        REQUIRE(getMatches(trie, "selection", 0) == Matches{{3, 3}, {2, 6}});
+
+        REQUIRE(getMatches(trie, "select", 0) == Matches{{3, 3}, {2, 6}});
+    }
+}
@@ -0,0 +1,133 @@
+#include "dansandu/glyph/internal/nfa.hpp"
+#include "dansandu/glyph/internal/pattern_compiler.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using dansandu::glyph::internal::pattern_compiler::ByteSet;
+using dansandu::glyph::internal::pattern_compiler::contains;
+using dansandu::glyph::internal::pattern_compiler::PatternCompiler;
+
+namespace dansandu::glyph::internal::nfa
+{
+
+// Lets the pattern compiler shared with the static automata build a runtime automaton.
+class NfaBuilder
+{
+public:
+    explicit NfaBuilder(Nfa& nfa) : nfa_{nfa}
+    {
+    }
+
+    int addState()
+    {
+        nfa_.states.push_back({{}, -1, {}});
+        return static_cast<int>(nfa_.states.size()) - 1;
+    }
+
+    void setTransition(const int from, const ByteSet& characters, const int to)
+    {
+        auto& state = nfa_.states[from];
+        for (auto character = 0; character < 256; ++character)
+        {
+            state.characters[character] = contains(characters, character);
+        }
+        state.next = to;
+    }
+
+    void addEpsilon(const int from, const int to)
+    {
+        nfa_.states[from].epsilonTransitions.push_back(to);
+    }
+
+private:
+    Nfa& nfa_;
+};
+
+Nfa getNfa(const std::string_view pattern)
+{
+    auto nfa = Nfa{};
+    auto builder = NfaBuilder{nfa};
+    const auto fragment = PatternCompiler<NfaBuilder>{builder, pattern}.compile();
+    nfa.startStateIndex = fragment.start;
+    nfa.finalStateIndex = fragment.end;
+    return nfa;
+}
+
+std::vector<int> getEpsilonClosure(const Nfa& nfa, std::vector<int> stateIndices)
+{
+    auto visited = std::vector<bool>(nfa.states.size());
+    for (const auto stateIndex : stateIndices)
+    {
+        visited[stateIndex] = true;
+    }
+    auto stack = stateIndices;
+    while (!stack.empty())
+    {
+        const auto stateIndex = stack.back();
+        stack.pop_back();
+        for (const auto nextStateIndex : nfa.states[stateIndex].epsilonTransitions)
+        {
+            if (!visited[nextStateIndex])
+            {
+                visited[nextStateIndex] = true;
+                stateIndices.push_back(nextStateIndex);
+                stack.push_back(nextStateIndex);
+            }
+        }
+    }
+    std::sort(stateIndices.begin(), stateIndices.end());
+    return stateIndices;
+}
+
+CharacterSet getFirstCharacters(const Nfa& nfa)
+{
+    auto firstCharacters = CharacterSet{};
+    for (const auto stateIndex : getEpsilonClosure(nfa, {nfa.startStateIndex}))
+    {
+        if (stateIndex == nfa.finalStateIndex)
+        {
+            return CharacterSet{}.set();
+        }
+        firstCharacters |= nfa.states[stateIndex].characters;
+    }
+    return firstCharacters;
+}
+
+std::optional<std::string> getLiteral(const Nfa& nfa)
+{
+    auto literal = std::string{};
+    auto stateIndex = nfa.startStateIndex;
+    while (stateIndex != nfa.finalStateIndex)
+    {
+        const auto& state = nfa.states[stateIndex];
+        if (state.next != -1 && state.characters.count() == 1)
+        {
+            auto character = 0;
+            while (!state.characters[character])
+            {
+                ++character;
+            }
+            literal.push_back(static_cast<char>(character));
+            stateIndex = state.next;
+        }
+        else if (state.next == -1 && state.epsilonTransitions.size() == 1)
+        {
+            stateIndex = state.epsilonTransitions.front();
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+    if (!nfa.states[stateIndex].epsilonTransitions.empty())
+    {
+        return std::nullopt;
+    }
+    return literal;
+}
+
+}
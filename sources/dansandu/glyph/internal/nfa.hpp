@@ -0,0 +1,42 @@
+#pragma once
+
+#include <bitset>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dansandu::glyph::internal::nfa
+{
+
+using CharacterSet = std::bitset<256>;
+
+// Each state either consumes one character from its set and moves to the next state or it has epsilon transitions.
+struct NfaState
+{
+    CharacterSet characters;
+    int next;
+    std::vector<int> epsilonTransitions;
+};
+
+struct Nfa
+{
+    std::vector<NfaState> states;
+    int startStateIndex;
+    int finalStateIndex;
+};
+
+// Compiles a subset of the ECMAScript regular expression syntax into a Thompson automaton working on bytes. Anchors,
+// word boundaries, backreferences, lookarounds and lazy quantifiers are rejected with a PatternError.
+Nfa getNfa(const std::string_view pattern);
+
+std::vector<int> getEpsilonClosure(const Nfa& nfa, std::vector<int> stateIndices);
+
+// Yields the characters a non-empty match can start with. If the automaton also matches the empty string every
+// character is returned since a match can start anywhere.
+CharacterSet getFirstCharacters(const Nfa& nfa);
+
+// Yields the only string the automaton matches if it matches exactly one string.
+std::optional<std::string> getLiteral(const Nfa& nfa);
+
+}
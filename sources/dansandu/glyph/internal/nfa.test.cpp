@@ -0,0 +1,162 @@
+#include "dansandu/glyph/internal/nfa.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/error.hpp"
+
+#include <string_view>
+#include <vector>
+
+using dansandu::glyph::error::PatternError;
+using dansandu::glyph::internal::nfa::CharacterSet;
+using dansandu::glyph::internal::nfa::getEpsilonClosure;
+using dansandu::glyph::internal::nfa::getFirstCharacters;
+using dansandu::glyph::internal::nfa::getLiteral;
+using dansandu::glyph::internal::nfa::getNfa;
+using dansandu::glyph::internal::nfa::Nfa;
+
+static bool matches(const Nfa& nfa, const std::string_view text)
+{
+    auto current = getEpsilonClosure(nfa, {nfa.startStateIndex});
+    for (const auto character : text)
+    {
+        auto next = std::vector<int>{};
+        for (const auto stateIndex : current)
+        {
+            const auto& state = nfa.states[stateIndex];
+            if (state.next != -1 && state.characters[static_cast<unsigned char>(character)])
+            {
+                next.push_back(state.next);
+            }
+        }
+        current = getEpsilonClosure(nfa, std::move(next));
+    }
+    return std::find(current.cbegin(), current.cend(), nfa.finalStateIndex) != current.cend();
+}
+
+TEST_CASE("Nfa")
+{
+    SECTION("literals and escapes")
+    {
+        const auto nfa = getNfa("a\\+\\.\\x41\\t");
+
+        REQUIRE(matches(nfa, "a+.A\t"));
+
+        REQUIRE(!matches(nfa, "a+.A"));
+
+        REQUIRE(!matches(nfa, "a+xA\t"));
+    }
+
+    SECTION("character classes")
+    {
+        const auto nfa = getNfa("[a-c_][^0-9\\s]\\d\\w\\S.");
+
+        REQUIRE(matches(nfa, "b_9zxy"));
+
+        REQUIRE(!matches(nfa, "d_9zxy"));
+
+        REQUIRE(!matches(nfa, "a 9zxy"));
+
+        REQUIRE(!matches(nfa, "ab9z x"));
+
+        REQUIRE(!matches(nfa, "ab9zx\n"));
+    }
+
+    SECTION("alternations and groups")
+    {
+        const auto nfa = getNfa("(?:ab|c)(d|)");
+
+        REQUIRE(matches(nfa, "ab"));
+
+        REQUIRE(matches(nfa, "cd"));
+
+        REQUIRE(!matches(nfa, "abc"));
+    }
+
+    SECTION("quantifiers")
+    {
+        const auto nfa = getNfa("a*b+c?d{2}e{1,2}f{2,}");
+
+        REQUIRE(matches(nfa, "bddeff"));
+
+        REQUIRE(matches(nfa, "aabbbcddeefff"));
+
+        REQUIRE(!matches(nfa, "bddeeeff"));
+
+        REQUIRE(!matches(nfa, "bdeff"));
+
+        REQUIRE(!matches(nfa, "bddef"));
+    }
+
+    SECTION("empty pattern")
+    {
+        const auto nfa = getNfa("");
+
+        REQUIRE(matches(nfa, ""));
+
+        REQUIRE(!matches(nfa, "a"));
+    }
+
+    SECTION("invalid patterns")
+    {
+        REQUIRE_THROWS_AS(getNfa("(a"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("a)"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("[a"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("[z-a]"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("a{3,1}"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("*a"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("a\\"), PatternError);
+    }
+
+    SECTION("unsupported patterns")
+    {
+        REQUIRE_THROWS_AS(getNfa("^a"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("a$"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("\\ba"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("(a)\\1"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("a(?!b)"), PatternError);
+
+        REQUIRE_THROWS_AS(getNfa("a*?"), PatternError);
+    }
+
+    SECTION("first characters")
+    {
+        auto expected = CharacterSet{};
+        expected.set('a').set('b').set('c').set('x');
+
+        REQUIRE(getFirstCharacters(getNfa("(?:a|b)+z|c?x")) == expected);
+
+        REQUIRE(getFirstCharacters(getNfa("\\d")).count() == 10);
+
+        REQUIRE(getFirstCharacters(getNfa("a*")).all());
+
+        REQUIRE(getFirstCharacters(getNfa("(?:)")).all());
+    }
+
+    SECTION("literals")
+    {
+        REQUIRE(getLiteral(getNfa("select")) == "select");
+
+        REQUIRE(getLiteral(getNfa("\\+\\((?:\\*)[.]")) == "+(*.");
+
+        REQUIRE(getLiteral(getNfa("a{3}")) == "aaa");
+
+        REQUIRE(getLiteral(getNfa("")) == "");
+
+        REQUIRE(!getLiteral(getNfa("a|b")).has_value());
+
+        REQUIRE(!getLiteral(getNfa("[ab]")).has_value());
+
+        REQUIRE(!getLiteral(getNfa("ab?")).has_value());
+
+        REQUIRE(!getLiteral(getNfa("a+")).has_value());
+    }
+}
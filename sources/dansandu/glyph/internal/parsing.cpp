@@ -2,55 +2,200 @@
 #include "dansandu/ballotin/exception.hpp"
 #include "dansandu/ballotin/string.hpp"
 #include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/internal/compressed_parsing_table.hpp"
 #include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/lazy_parsing_table.hpp"
 #include "dansandu/glyph/internal/text_location.hpp"
 #include "dansandu/glyph/node.hpp"
 #include "dansandu/glyph/symbol.hpp"
 #include "dansandu/glyph/token.hpp"
+#include "dansandu/glyph/tokenizer.hpp"
 
+#include <cstdint>
 #include <functional>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
 using dansandu::ballotin::string::format;
 using dansandu::ballotin::string::join;
 using dansandu::glyph::error::SyntaxError;
+using dansandu::glyph::internal::compressed_parsing_table::CompressedParsingTable;
 using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::lazy_parsing_table::LazyParsingTable;
+using dansandu::glyph::internal::lazy_parsing_table::Row;
 using dansandu::glyph::internal::parsing_table::Action;
 using dansandu::glyph::internal::parsing_table::Cell;
+using dansandu::glyph::internal::parsing_table::getExpectedSymbols;
 using dansandu::glyph::internal::text_location::getTextLocation;
 using dansandu::glyph::node::Node;
 using dansandu::glyph::symbol::Symbol;
 using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::ITokenStream;
+using dansandu::glyph::tokenizer::TokenViewStream;
 
 namespace dansandu::glyph::internal::parsing
 {
 
-std::vector<Node> parse(const std::string_view text, const std::vector<Token>& tokens,
-                        const std::vector<std::vector<Cell>>& parsingTable, const Grammar& grammar)
+static Token getNextToken(const std::string_view text, ITokenStream& tokens,
+                          const std::vector<Symbol>& expectedSymbols, const Grammar& grammar)
 {
-    auto nodes = std::vector<Node>{};
+    auto token = tokens.nextExpectedToken(expectedSymbols);
+    while (token.has_value() && token->getSymbol() == grammar.getDiscardedSymbolPlaceholder())
+    {
+        token = tokens.nextExpectedToken(expectedSymbols);
+    }
+    const auto textSize = static_cast<std::int64_t>(text.size());
+    return token.has_value() ? token.value() : Token{grammar.getEndOfStringSymbol(), textSize, textSize};
+}
 
-    const auto textSize = static_cast<int>(text.size());
+// Reads the cells of a table built up front.
+class TableReader
+{
+public:
+    TableReader(const std::vector<std::vector<Cell>>& parsingTable,
+                const std::vector<std::vector<Symbol>>& expectedSymbols)
+        : parsingTable_{parsingTable}, expectedSymbols_{expectedSymbols}
+    {
+    }
 
-    auto tokenPosition = tokens.cbegin();
-    auto stateStack = std::vector<int>{grammar.getStartRuleIndex()};
-    while (!stateStack.empty())
+    Cell getCell(const int symbolIndex, const int stateIndex)
     {
-        while (tokenPosition != tokens.cend() && tokenPosition->getSymbol() == grammar.getDiscardedSymbolPlaceholder())
+        return parsingTable_[symbolIndex][stateIndex];
+    }
+
+    Cell getDefaultReduction(const int)
+    {
+        return Cell{};
+    }
+
+    const std::vector<Symbol>& getExpectedSymbols(const int stateIndex)
+    {
+        return expectedSymbols_[stateIndex];
+    }
+
+    int getSymbolsCount() const
+    {
+        return static_cast<int>(parsingTable_.size());
+    }
+
+private:
+    const std::vector<std::vector<Cell>>& parsingTable_;
+    const std::vector<std::vector<Symbol>>& expectedSymbols_;
+};
+
+// Reads the cells of a table compressed by row displacement.
+class CompressedTableReader
+{
+public:
+    CompressedTableReader(const CompressedParsingTable& parsingTable,
+                          const std::vector<std::vector<Symbol>>& expectedSymbols)
+        : parsingTable_{parsingTable}, expectedSymbols_{expectedSymbols}
+    {
+    }
+
+    Cell getCell(const int symbolIndex, const int stateIndex)
+    {
+        return compressed_parsing_table::getCell(parsingTable_, symbolIndex, stateIndex);
+    }
+
+    Cell getDefaultReduction(const int stateIndex)
+    {
+        const auto cell = parsingTable_.defaultCells[stateIndex];
+        return cell.action == Action::reduce ? cell : Cell{};
+    }
+
+    const std::vector<Symbol>& getExpectedSymbols(const int stateIndex)
+    {
+        return expectedSymbols_[stateIndex];
+    }
+
+    int getSymbolsCount() const
+    {
+        return parsingTable_.symbolsCount;
+    }
+
+private:
+    const CompressedParsingTable& parsingTable_;
+    const std::vector<std::vector<Symbol>>& expectedSymbols_;
+};
+
+// Reads the rows of a lazy table, keeping the rows it got so that the table lock is only taken the first time a state
+// is reached within a parse.
+class LazyTableReader
+{
+public:
+    LazyTableReader(const LazyParsingTable& parsingTable, const Grammar& grammar)
+        : parsingTable_{parsingTable}, symbolsCount_{static_cast<int>(grammar.getIdentifiers().size())}
+    {
+    }
+
+    Cell getCell(const int symbolIndex, const int stateIndex)
+    {
+        return getRow(stateIndex).cells[symbolIndex];
+    }
+
+    Cell getDefaultReduction(const int stateIndex)
+    {
+        return getRow(stateIndex).defaultReduction;
+    }
+
+    const std::vector<Symbol>& getExpectedSymbols(const int stateIndex)
+    {
+        return getRow(stateIndex).expectedSymbols;
+    }
+
+    int getSymbolsCount() const
+    {
+        return symbolsCount_;
+    }
+
+private:
+    const Row& getRow(const int stateIndex)
+    {
+        if (stateIndex >= static_cast<int>(rows_.size()))
+        {
+            rows_.resize(stateIndex + 1);
+        }
+        if (rows_[stateIndex] == nullptr)
         {
-            ++tokenPosition;
+            rows_[stateIndex] = &parsingTable_.getRow(stateIndex);
         }
+        return *rows_[stateIndex];
+    }
+
+    const LazyParsingTable& parsingTable_;
+    int symbolsCount_;
+    std::vector<const Row*> rows_;
+};
+
+// States with a default reduction reduce without looking at the next token, so a token is only read once a state has
+// to look at it and the tokenizer gets the expected symbols of that state.
+template<typename Reader>
+static std::vector<Node> parseTokens(const std::string_view text, ITokenStream& tokens, Reader& reader,
+                                     const Grammar& grammar)
+{
+    auto nodes = std::vector<Node>{};
 
-        const auto token =
-            tokenPosition != tokens.cend() ? *tokenPosition : Token{grammar.getEndOfStringSymbol(), textSize, textSize};
+    auto stateStack = std::vector<int>{grammar.getStartRuleIndex()};
+    auto token = std::optional<Token>{};
+    while (!stateStack.empty())
+    {
         const auto state = stateStack.back();
-        const auto cell = parsingTable[token.getSymbol().getIdentifierIndex()][state];
+        auto cell = reader.getDefaultReduction(state);
+        if (cell.action == Action::error)
+        {
+            if (!token.has_value())
+            {
+                token = getNextToken(text, tokens, reader.getExpectedSymbols(state), grammar);
+            }
+            cell = reader.getCell(token->getSymbol().getIdentifierIndex(), state);
+        }
         if (cell.action == Action::shift)
         {
             stateStack.push_back(cell.parameter);
-            nodes.push_back(Node{token});
-            ++tokenPosition;
+            nodes.push_back(Node{*token});
+            token.reset();
         }
         else if (cell.action == Action::reduce || cell.action == Action::accept)
         {
@@ -68,7 +213,7 @@ std::vector<Node> parse(const std::string_view text, const std::vector<Token>& t
                     THROW(std::logic_error, "invalid state reached -- insufficient stack size for reduction");
                 }
                 const auto newState =
-                    parsingTable[reductionRule.leftSide.getIdentifierIndex()][stateStack.back()].parameter;
+                    reader.getCell(reductionRule.leftSide.getIdentifierIndex(), stateStack.back()).parameter;
                 stateStack.push_back(newState);
                 nodes.push_back(Node{cell.parameter});
             }
@@ -82,9 +227,9 @@ std::vector<Node> parse(const std::string_view text, const std::vector<Token>& t
         {
             auto expectedSymbols = std::vector<Symbol>{};
             auto expectedSymbolsString = std::vector<std::string>{};
-            for (auto symbolIndex = 0; symbolIndex < static_cast<int>(parsingTable.size()); ++symbolIndex)
+            for (auto symbolIndex = 0; symbolIndex < reader.getSymbolsCount(); ++symbolIndex)
             {
-                if (parsingTable[symbolIndex][state].action != Action::error)
+                if (reader.getCell(symbolIndex, state).action != Action::error)
                 {
                     const auto symbol = Symbol{symbolIndex};
                     expectedSymbols.push_back(symbol);
@@ -92,18 +237,47 @@ std::vector<Node> parse(const std::string_view text, const std::vector<Token>& t
                 }
             }
 
-            const auto textLocation = getTextLocation(text, token.begin(), token.end());
+            const auto textLocation = getTextLocation(text, token->begin(), token->end());
 
             throw SyntaxError{format("invalid syntax at line ", textLocation.lineNumber, " and column ",
                                      textLocation.columnNumber, " with symbol '",
-                                     grammar.getIdentifier(token.getSymbol()),
+                                     grammar.getIdentifier(token->getSymbol()),
                                      "' -- the following symbols were expected: ", join(expectedSymbolsString, ", "),
                                      "\n", textLocation.highlight),
-                              textLocation.lineNumber, textLocation.columnNumber, token.getSymbol(), expectedSymbols};
+                              textLocation.lineNumber, textLocation.columnNumber, token->getSymbol(), expectedSymbols};
         }
     }
 
     return nodes;
 }
 
+std::vector<Node> parse(const std::string_view text, ITokenStream& tokens,
+                        const std::vector<std::vector<Cell>>& parsingTable,
+                        const std::vector<std::vector<Symbol>>& expectedSymbols, const Grammar& grammar)
+{
+    auto reader = TableReader{parsingTable, expectedSymbols};
+    return parseTokens(text, tokens, reader, grammar);
+}
+
+std::vector<Node> parse(const std::string_view text, ITokenStream& tokens, const CompressedParsingTable& parsingTable,
+                        const std::vector<std::vector<Symbol>>& expectedSymbols, const Grammar& grammar)
+{
+    auto reader = CompressedTableReader{parsingTable, expectedSymbols};
+    return parseTokens(text, tokens, reader, grammar);
+}
+
+std::vector<Node> parse(const std::string_view text, ITokenStream& tokens, const LazyParsingTable& parsingTable,
+                        const Grammar& grammar)
+{
+    auto reader = LazyTableReader{parsingTable, grammar};
+    return parseTokens(text, tokens, reader, grammar);
+}
+
+std::vector<Node> parse(const std::string_view text, const std::vector<Token>& tokens,
+                        const std::vector<std::vector<Cell>>& parsingTable, const Grammar& grammar)
+{
+    auto tokenStream = TokenViewStream{tokens};
+    return parse(text, tokenStream, parsingTable, getExpectedSymbols(grammar, parsingTable), grammar);
+}
+
 }
@@ -1,15 +1,37 @@
 #pragma once
 
+#include "dansandu/glyph/internal/compressed_parsing_table.hpp"
 #include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/lazy_parsing_table.hpp"
 #include "dansandu/glyph/internal/parsing_table.hpp"
 #include "dansandu/glyph/node.hpp"
+#include "dansandu/glyph/symbol.hpp"
 #include "dansandu/glyph/token.hpp"
+#include "dansandu/glyph/tokenizer.hpp"
 
 #include <vector>
 
 namespace dansandu::glyph::internal::parsing
 {
 
+std::vector<dansandu::glyph::node::Node>
+parse(const std::string_view text, dansandu::glyph::tokenizer::ITokenStream& tokens,
+      const std::vector<std::vector<dansandu::glyph::internal::parsing_table::Cell>>& parsingTable,
+      const std::vector<std::vector<dansandu::glyph::symbol::Symbol>>& expectedSymbols,
+      const dansandu::glyph::internal::grammar::Grammar& grammar);
+
+std::vector<dansandu::glyph::node::Node>
+parse(const std::string_view text, dansandu::glyph::tokenizer::ITokenStream& tokens,
+      const dansandu::glyph::internal::compressed_parsing_table::CompressedParsingTable& parsingTable,
+      const std::vector<std::vector<dansandu::glyph::symbol::Symbol>>& expectedSymbols,
+      const dansandu::glyph::internal::grammar::Grammar& grammar);
+
+// Computes the rows of the states the parse reaches for the first time.
+std::vector<dansandu::glyph::node::Node>
+parse(const std::string_view text, dansandu::glyph::tokenizer::ITokenStream& tokens,
+      const dansandu::glyph::internal::lazy_parsing_table::LazyParsingTable& parsingTable,
+      const dansandu::glyph::internal::grammar::Grammar& grammar);
+
 std::vector<dansandu::glyph::node::Node>
 parse(const std::string_view text, const std::vector<dansandu::glyph::token::Token>& tokens,
       const std::vector<std::vector<dansandu::glyph::internal::parsing_table::Cell>>& parsingTable,
@@ -2,14 +2,24 @@
 #include "dansandu/ballotin/exception.hpp"
 #include "dansandu/glyph/error.hpp"
 #include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/first_table.hpp"
 #include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/lalr.hpp"
+#include "dansandu/glyph/internal/symbol_set.hpp"
+#include "dansandu/glyph/symbol.hpp"
 
 #include <ostream>
 #include <stdexcept>
 #include <vector>
 
 using dansandu::glyph::internal::automaton::Automaton;
+using dansandu::glyph::internal::automaton::getClosureTemplates;
+using dansandu::glyph::internal::automaton::getStateClosure;
+using dansandu::glyph::internal::first_table::getFirstTable;
 using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::lalr::getLalr1Reductions;
+using dansandu::glyph::internal::symbol_set::SymbolSet;
+using dansandu::glyph::symbol::Symbol;
 
 namespace dansandu::glyph::internal::parsing_table
 {
@@ -38,32 +48,49 @@ std::ostream& operator<<(std::ostream& stream, const Cell cell)
     return stream << "Cell(" << cell.action << ", " << cell.parameter << ")";
 }
 
-std::vector<std::vector<Cell>> getClr1ParsingTable(const Grammar& grammar, const Automaton& automaton)
+static std::vector<std::vector<Cell>> getTransitionsTable(const Grammar& grammar, const Automaton& automaton)
 {
     auto table = std::vector<std::vector<Cell>>(grammar.getIdentifiers().size());
     for (auto& row : table)
     {
-        row = std::vector<Cell>{automaton.states.size()};
+        row = std::vector<Cell>{automaton.kernels.size()};
     }
     for (const auto& transition : automaton.transitions)
     {
         const auto action = grammar.isTerminal(transition.symbol) ? Action::shift : Action::goTo;
         table[transition.symbol.getIdentifierIndex()][transition.from] = Cell{action, transition.to};
     }
+    return table;
+}
+
+static void addReduction(std::vector<std::vector<Cell>>& table, const Grammar& grammar, const int stateIndex,
+                         const int ruleIndex, const Symbol lookahead, const char* const parserName)
+{
+    auto& cell = table[lookahead.getIdentifierIndex()][stateIndex];
+    if (cell.action != Action::error)
+    {
+        THROW(std::logic_error, "grammar cannot be parsed using a ", parserName, " parser due to ", cell.action,
+              "/reduce conflict on symbol '", grammar.getIdentifier(lookahead), "'");
+    }
+    cell = Cell{Action::reduce, ruleIndex};
+}
+
+std::vector<std::vector<Cell>> getClr1ParsingTable(const Grammar& grammar, const Automaton& automaton)
+{
+    auto table = getTransitionsTable(grammar, automaton);
     const auto& rules = grammar.getRules();
-    for (auto stateIndex = 0U; stateIndex < automaton.states.size(); ++stateIndex)
+    const auto firstTable = getFirstTable(grammar);
+    const auto closureTemplates = getClosureTemplates(grammar, firstTable);
+    for (auto stateIndex = 0; stateIndex < static_cast<int>(automaton.kernels.size()); ++stateIndex)
     {
-        for (const auto& item : automaton.states[stateIndex])
+        for (const auto& item : getStateClosure(automaton.kernels[stateIndex], grammar, firstTable, closureTemplates))
         {
             if (item.position == static_cast<int>(rules[item.ruleIndex].rightSide.size()))
             {
-                auto& cell = table[item.lookahead.getIdentifierIndex()][stateIndex];
-                if (cell.action != Action::error)
+                for (const auto lookahead : item.lookaheads)
                 {
-                    THROW(std::logic_error, "grammar cannot be parsed using a CLR(1) parser due to ", cell.action,
-                          "/reduce conflict on symbol '", grammar.getIdentifier(item.lookahead), "'");
+                    addReduction(table, grammar, stateIndex, item.ruleIndex, lookahead, "CLR(1)");
                 }
-                cell = Cell{Action::reduce, item.ruleIndex};
             }
         }
     }
@@ -72,4 +99,82 @@ std::vector<std::vector<Cell>> getClr1ParsingTable(const Grammar& grammar, const
     return table;
 }
 
+std::vector<std::vector<Cell>> getLalr1ParsingTable(const Grammar& grammar, const Automaton& lr0Automaton)
+{
+    auto table = getTransitionsTable(grammar, lr0Automaton);
+    const auto reductions = getLalr1Reductions(grammar, lr0Automaton);
+    for (auto stateIndex = 0; stateIndex < static_cast<int>(reductions.size()); ++stateIndex)
+    {
+        for (const auto& reduction : reductions[stateIndex])
+        {
+            for (const auto lookahead : reduction.lookaheads)
+            {
+                addReduction(table, grammar, stateIndex, reduction.ruleIndex, lookahead, "LALR(1)");
+            }
+        }
+    }
+    table[grammar.getEndOfStringSymbol().getIdentifierIndex()][lr0Automaton.finalStateIndex] =
+        Cell{Action::accept, grammar.getStartRuleIndex()};
+    return table;
+}
+
+std::vector<Cell> getDefaultReductions(const std::vector<std::vector<Cell>>& parsingTable)
+{
+    const auto statesCount = parsingTable.empty() ? 0 : static_cast<int>(parsingTable.front().size());
+    auto defaultReductions = std::vector<Cell>(statesCount);
+    auto consistent = std::vector<bool>(statesCount, true);
+    for (auto symbolIndex = 0; symbolIndex < static_cast<int>(parsingTable.size()); ++symbolIndex)
+    {
+        for (auto stateIndex = 0; stateIndex < statesCount; ++stateIndex)
+        {
+            const auto cell = parsingTable[symbolIndex][stateIndex];
+            if (cell.action == Action::error || cell.action == Action::goTo || !consistent[stateIndex])
+            {
+                continue;
+            }
+            auto& defaultReduction = defaultReductions[stateIndex];
+            if (cell.action != Action::reduce ||
+                (defaultReduction.action == Action::reduce && defaultReduction.parameter != cell.parameter))
+            {
+                consistent[stateIndex] = false;
+                defaultReduction = Cell{};
+            }
+            else
+            {
+                defaultReduction = cell;
+            }
+        }
+    }
+    return defaultReductions;
+}
+
+std::vector<std::vector<Symbol>> getExpectedSymbols(const Grammar& grammar,
+                                                   const std::vector<std::vector<Cell>>& parsingTable)
+{
+    const auto statesCount = parsingTable.empty() ? 0 : parsingTable.front().size();
+    auto expectedSets = std::vector<SymbolSet>(statesCount, SymbolSet{grammar});
+    for (auto symbolIndex = grammar.getEndOfStringSymbol().getIdentifierIndex();
+         symbolIndex < static_cast<int>(parsingTable.size()); ++symbolIndex)
+    {
+        for (auto stateIndex = 0U; stateIndex < statesCount; ++stateIndex)
+        {
+            if (parsingTable[symbolIndex][stateIndex].action != Action::error)
+            {
+                expectedSets[stateIndex].insert(Symbol{symbolIndex});
+            }
+        }
+    }
+    auto expectedSymbols = std::vector<std::vector<Symbol>>(statesCount);
+    for (auto stateIndex = 0U; stateIndex < statesCount; ++stateIndex)
+    {
+        expectedSymbols[stateIndex].reserve(expectedSets[stateIndex].size() + 1);
+        expectedSymbols[stateIndex].push_back(grammar.getDiscardedSymbolPlaceholder());
+        for (const auto symbol : expectedSets[stateIndex])
+        {
+            expectedSymbols[stateIndex].push_back(symbol);
+        }
+    }
+    return expectedSymbols;
+}
+
 }
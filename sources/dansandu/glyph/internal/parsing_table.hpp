@@ -2,6 +2,7 @@
 
 #include "dansandu/glyph/internal/automaton.hpp"
 #include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/symbol.hpp"
 
 #include <ostream>
 #include <vector>
@@ -49,4 +50,22 @@ std::ostream& operator<<(std::ostream& stream, const Cell cell);
 std::vector<std::vector<Cell>> getClr1ParsingTable(const dansandu::glyph::internal::grammar::Grammar& grammar,
                                                    const dansandu::glyph::internal::automaton::Automaton& automaton);
 
+// Builds the LALR(1) table from the LR(0) automaton, which has as many states as the LR(0) automaton instead of the
+// many copies of a state the canonical LR(1) automaton has for different lookaheads. Grammars that are LR(1) but not
+// LALR(1) fail with a reduce/reduce conflict.
+std::vector<std::vector<Cell>>
+getLalr1ParsingTable(const dansandu::glyph::internal::grammar::Grammar& grammar,
+                     const dansandu::glyph::internal::automaton::Automaton& lr0Automaton);
+
+// Yields for each state the reduction it makes whatever the lookahead is, when all its terminal actions are reductions
+// by the same rule, or an error cell otherwise. Reducing without the lookahead only delays detecting an invalid token
+// until a state that has to look at it, so the token is still never shifted.
+std::vector<Cell> getDefaultReductions(const std::vector<std::vector<Cell>>& parsingTable);
+
+// Lists for each state the sorted terminals that don't lead to an error action along with the discarded symbol
+// placeholder, which can always be skipped.
+std::vector<std::vector<dansandu::glyph::symbol::Symbol>>
+getExpectedSymbols(const dansandu::glyph::internal::grammar::Grammar& grammar,
+                   const std::vector<std::vector<Cell>>& parsingTable);
+
 }
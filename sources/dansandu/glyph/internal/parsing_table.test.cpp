@@ -6,10 +6,15 @@
 #include <vector>
 
 using dansandu::glyph::internal::automaton::getAutomaton;
+using dansandu::glyph::internal::automaton::getLr0Automaton;
 using dansandu::glyph::internal::grammar::Grammar;
 using dansandu::glyph::internal::parsing_table::Action;
 using dansandu::glyph::internal::parsing_table::Cell;
 using dansandu::glyph::internal::parsing_table::getClr1ParsingTable;
+using dansandu::glyph::internal::parsing_table::getDefaultReductions;
+using dansandu::glyph::internal::parsing_table::getExpectedSymbols;
+using dansandu::glyph::internal::parsing_table::getLalr1ParsingTable;
+using dansandu::glyph::symbol::Symbol;
 
 // clang-format off
 TEST_CASE("Parsing table") {
@@ -38,5 +43,30 @@ TEST_CASE("Parsing table") {
         {         {},          {}, {shift,  5}, {reduce, 4},          {},          {}, {shift,  5}, {reduce, 3}},
         {{shift,  3},          {},          {},          {}, {shift,  3}, {shift,  7},          {},          {}}
     });
+
+    REQUIRE(getLalr1ParsingTable(grammar, getLr0Automaton(grammar)) == table);
+
+    const auto discarded = grammar.getDiscardedSymbolPlaceholder(),
+               end = grammar.getSymbol("$"),
+               add = grammar.getSymbol("add"),
+               multiply = grammar.getSymbol("multiply"),
+               number = grammar.getSymbol("number");
+
+    REQUIRE(getExpectedSymbols(grammar, table) == std::vector<std::vector<Symbol>>{
+        {discarded, number},
+        {discarded, end, add},
+        {discarded, end, add, multiply},
+        {discarded, end, add, multiply},
+        {discarded, number},
+        {discarded, number},
+        {discarded, end, add, multiply},
+        {discarded, end, add, multiply}
+    });
+
+    REQUIRE(getDefaultReductions(table) == std::vector<Cell>{
+        {}, {}, {}, {reduce, 4}, {}, {}, {}, {reduce, 3}
+    });
+
+    REQUIRE(getDefaultReductions({}).empty());
 }
 // clang-format on
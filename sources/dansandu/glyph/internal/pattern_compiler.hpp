@@ -0,0 +1,512 @@
+#pragma once
+
+#include "dansandu/ballotin/exception.hpp"
+#include "dansandu/glyph/error.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace dansandu::glyph::internal::pattern_compiler
+{
+
+// Set of bytes stored as four words of bits.
+using ByteSet = std::array<std::uint64_t, 4>;
+
+constexpr bool contains(const ByteSet& characters, const int character)
+{
+    return (characters[character / 64] >> (character % 64)) & 1;
+}
+
+constexpr ByteSet makeRange(const int first, const int last)
+{
+    auto characters = ByteSet{};
+    for (auto character = first; character <= last; ++character)
+    {
+        characters[character / 64] |= std::uint64_t{1} << (character % 64);
+    }
+    return characters;
+}
+
+constexpr ByteSet unite(const ByteSet& left, const ByteSet& right)
+{
+    auto characters = ByteSet{};
+    for (auto word = 0; word < 4; ++word)
+    {
+        characters[word] = left[word] | right[word];
+    }
+    return characters;
+}
+
+constexpr ByteSet complement(const ByteSet& characters)
+{
+    auto complemented = ByteSet{};
+    for (auto word = 0; word < 4; ++word)
+    {
+        complemented[word] = ~characters[word];
+    }
+    return complemented;
+}
+
+struct Fragment
+{
+    int start;
+    int end;
+};
+
+// Isn't a constant expression, so malformed patterns compiled at compile time fail to compile with an error naming it.
+[[noreturn]] inline void failPattern(const char* const reason, const std::string_view pattern,
+                                     const std::size_t position)
+{
+    THROW(dansandu::glyph::error::PatternError, reason, " at position ", position, " in pattern '", pattern, "'");
+}
+
+// Compiles a subset of the ECMAScript regular expression syntax into a Thompson automaton working on bytes, calling
+// addState, setTransition and addEpsilon on the builder as it parses. Anchors, word boundaries, backreferences,
+// lookarounds and lazy quantifiers are rejected with a PatternError. The compiler is a constant expression so that the
+// same code builds the runtime automata of the nfa module and the compile time ones of the static_automaton module.
+// Counted repetitions are compiled by parsing the repeated operand again for every copy since there is no expression
+// tree to duplicate, and the states created never have more than two epsilon transitions.
+template<typename Builder>
+class PatternCompiler
+{
+public:
+    constexpr PatternCompiler(Builder& builder, const std::string_view pattern)
+        : builder_{builder}, pattern_{pattern}, position_{0}
+    {
+    }
+
+    constexpr Fragment compile()
+    {
+        const auto fragment = parseAlternation();
+        if (!atEnd())
+        {
+            fail("unbalanced parenthesis");
+        }
+        return fragment;
+    }
+
+private:
+    static constexpr auto unbounded = -1;
+
+    [[noreturn]] constexpr void fail(const char* const reason) const
+    {
+        failPattern(reason, pattern_, position_);
+    }
+
+    constexpr bool atEnd() const
+    {
+        return position_ == pattern_.size();
+    }
+
+    constexpr char peek() const
+    {
+        return pattern_[position_];
+    }
+
+    constexpr bool consume(const char character)
+    {
+        if (!atEnd() && peek() == character)
+        {
+            ++position_;
+            return true;
+        }
+        return false;
+    }
+
+    constexpr Fragment makeEmpty()
+    {
+        const auto state = builder_.addState();
+        return {state, state};
+    }
+
+    constexpr Fragment makeCharacters(const ByteSet& characters)
+    {
+        const auto start = builder_.addState();
+        const auto end = builder_.addState();
+        builder_.setTransition(start, characters, end);
+        return {start, end};
+    }
+
+    constexpr void append(Fragment& sequence, const Fragment& fragment)
+    {
+        if (sequence.start == -1)
+        {
+            sequence = fragment;
+        }
+        else
+        {
+            builder_.addEpsilon(sequence.end, fragment.start);
+            sequence.end = fragment.end;
+        }
+    }
+
+    constexpr Fragment makeOptional(const Fragment& fragment, const bool repeated)
+    {
+        const auto start = builder_.addState();
+        const auto end = builder_.addState();
+        builder_.addEpsilon(start, fragment.start);
+        builder_.addEpsilon(start, end);
+        if (repeated)
+        {
+            builder_.addEpsilon(fragment.end, fragment.start);
+        }
+        builder_.addEpsilon(fragment.end, end);
+        return {start, end};
+    }
+
+    constexpr Fragment parseAlternation()
+    {
+        auto fragment = parseConcatenation();
+        while (consume('|'))
+        {
+            const auto alternative = parseConcatenation();
+            const auto start = builder_.addState();
+            const auto end = builder_.addState();
+            builder_.addEpsilon(start, fragment.start);
+            builder_.addEpsilon(start, alternative.start);
+            builder_.addEpsilon(fragment.end, end);
+            builder_.addEpsilon(alternative.end, end);
+            fragment = {start, end};
+        }
+        return fragment;
+    }
+
+    constexpr Fragment parseConcatenation()
+    {
+        auto sequence = Fragment{-1, -1};
+        while (!atEnd() && peek() != '|' && peek() != ')')
+        {
+            append(sequence, parseRepetition(pattern_.size()));
+        }
+        return sequence.start == -1 ? makeEmpty() : sequence;
+    }
+
+    // Parses an atom followed by the quantifiers that start before the limit.
+    constexpr Fragment parseRepetition(const std::size_t limit)
+    {
+        const auto operandBegin = position_;
+        auto fragment = parseAtom();
+        while (!atEnd() && position_ < limit)
+        {
+            const auto quantifierBegin = position_;
+            auto minimum = 0;
+            auto maximum = unbounded;
+            if (consume('*'))
+            {
+            }
+            else if (consume('+'))
+            {
+                minimum = 1;
+            }
+            else if (consume('?'))
+            {
+                maximum = 1;
+            }
+            else if (consume('{'))
+            {
+                minimum = parseCount();
+                maximum = minimum;
+                if (consume(','))
+                {
+                    maximum = !atEnd() && peek() == '}' ? unbounded : parseCount();
+                }
+                if (!consume('}'))
+                {
+                    fail("unterminated repetition count");
+                }
+                if (maximum != unbounded && maximum < minimum)
+                {
+                    fail("repetition count range is out of order");
+                }
+            }
+            else
+            {
+                break;
+            }
+            if (consume('?'))
+            {
+                fail("lazy quantifiers are not supported");
+            }
+            const auto quantifierEnd = position_;
+            fragment = repeat(fragment, operandBegin, quantifierBegin, minimum, maximum);
+            position_ = quantifierEnd;
+        }
+        return fragment;
+    }
+
+    constexpr Fragment repeat(const Fragment& operand, const std::size_t operandBegin,
+                                    const std::size_t operandEnd, const int minimum, const int maximum)
+    {
+        auto copies = 0;
+        const auto getCopy = [this, &operand, &copies, operandBegin, operandEnd]()
+        {
+            if (copies++ == 0)
+            {
+                return operand;
+            }
+            position_ = operandBegin;
+            return parseRepetition(operandEnd);
+        };
+
+        auto sequence = Fragment{-1, -1};
+        for (auto count = 0; count < minimum; ++count)
+        {
+            append(sequence, getCopy());
+        }
+        if (maximum == unbounded)
+        {
+            append(sequence, makeOptional(getCopy(), true));
+        }
+        else
+        {
+            for (auto count = minimum; count < maximum; ++count)
+            {
+                append(sequence, makeOptional(getCopy(), false));
+            }
+        }
+        return sequence.start == -1 ? makeEmpty() : sequence;
+    }
+
+    constexpr int parseCount()
+    {
+        auto count = 0;
+        auto digits = 0;
+        while (!atEnd() && peek() >= '0' && peek() <= '9')
+        {
+            count = count * 10 + (peek() - '0');
+            ++position_;
+            if (++digits > 4)
+            {
+                fail("repetition count is too large");
+            }
+        }
+        if (digits == 0)
+        {
+            fail("expected repetition count");
+        }
+        return count;
+    }
+
+    constexpr Fragment parseAtom()
+    {
+        const auto character = peek();
+        switch (character)
+        {
+        case '(':
+        {
+            ++position_;
+            if (consume('?') && !consume(':'))
+            {
+                fail("lookarounds are not supported");
+            }
+            const auto fragment = parseAlternation();
+            if (!consume(')'))
+            {
+                fail("unbalanced parenthesis");
+            }
+            return fragment;
+        }
+        case '[':
+            ++position_;
+            return makeCharacters(parseClass());
+        case '.':
+            ++position_;
+            return makeCharacters(complement(unite(makeRange('\n', '\n'), makeRange('\r', '\r'))));
+        case '\\':
+        {
+            ++position_;
+            auto characters = ByteSet{};
+            parseEscape(false, characters);
+            return makeCharacters(characters);
+        }
+        case '^':
+        case '$':
+            fail("anchors are not supported");
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+            fail("nothing to repeat");
+        default:
+            ++position_;
+            const auto byte = static_cast<unsigned char>(character);
+            return makeCharacters(makeRange(byte, byte));
+        }
+    }
+
+    constexpr ByteSet parseClass()
+    {
+        const auto negated = consume('^');
+        auto characters = ByteSet{};
+        while (!consume(']'))
+        {
+            if (atEnd())
+            {
+                fail("unterminated character class");
+            }
+            auto first = ByteSet{};
+            const auto firstCharacter = parseClassAtom(first);
+            if (!atEnd() && peek() == '-' && position_ + 1 < pattern_.size() && pattern_[position_ + 1] != ']')
+            {
+                ++position_;
+                auto last = ByteSet{};
+                const auto lastCharacter = parseClassAtom(last);
+                if (firstCharacter == -1 || lastCharacter == -1)
+                {
+                    fail("character class escapes cannot bound a range");
+                }
+                if (firstCharacter > lastCharacter)
+                {
+                    fail("character class range is out of order");
+                }
+                characters = unite(characters, makeRange(firstCharacter, lastCharacter));
+            }
+            else
+            {
+                characters = unite(characters, first);
+            }
+        }
+        return negated ? complement(characters) : characters;
+    }
+
+    // Yields the single character of the atom, or -1 if it is a class escape such as \d.
+    constexpr int parseClassAtom(ByteSet& characters)
+    {
+        const auto character = static_cast<unsigned char>(peek());
+        ++position_;
+        if (character == '\\')
+        {
+            return parseEscape(true, characters);
+        }
+        characters = makeRange(character, character);
+        return character;
+    }
+
+    constexpr int parseHexadecimal(const int digits)
+    {
+        auto value = 0;
+        for (auto index = 0; index < digits; ++index)
+        {
+            if (atEnd())
+            {
+                fail("incomplete hexadecimal escape");
+            }
+            const auto character = peek();
+            ++position_;
+            if (character >= '0' && character <= '9')
+            {
+                value = value * 16 + (character - '0');
+            }
+            else if (character >= 'a' && character <= 'f')
+            {
+                value = value * 16 + (character - 'a' + 10);
+            }
+            else if (character >= 'A' && character <= 'F')
+            {
+                value = value * 16 + (character - 'A' + 10);
+            }
+            else
+            {
+                fail("invalid hexadecimal escape");
+            }
+        }
+        return value;
+    }
+
+    constexpr int parseEscape(const bool insideClass, ByteSet& characters)
+    {
+        if (atEnd())
+        {
+            fail("pattern cannot end with an escape");
+        }
+        const auto character = peek();
+        ++position_;
+        const auto digits = makeRange('0', '9');
+        const auto wordCharacters =
+            unite(unite(makeRange('a', 'z'), makeRange('A', 'Z')), unite(digits, makeRange('_', '_')));
+        const auto whitespace = unite(makeRange(' ', ' '), makeRange('\t', '\r'));
+        auto single = -1;
+        switch (character)
+        {
+        case 'd':
+            characters = digits;
+            return -1;
+        case 'D':
+            characters = complement(digits);
+            return -1;
+        case 'w':
+            characters = wordCharacters;
+            return -1;
+        case 'W':
+            characters = complement(wordCharacters);
+            return -1;
+        case 's':
+            characters = whitespace;
+            return -1;
+        case 'S':
+            characters = complement(whitespace);
+            return -1;
+        case 't':
+            single = '\t';
+            break;
+        case 'n':
+            single = '\n';
+            break;
+        case 'r':
+            single = '\r';
+            break;
+        case 'f':
+            single = '\f';
+            break;
+        case 'v':
+            single = '\v';
+            break;
+        case '0':
+            single = '\0';
+            break;
+        case 'x':
+            single = parseHexadecimal(2);
+            break;
+        case 'u':
+            single = parseHexadecimal(4);
+            if (single > 0xFF)
+            {
+                fail("unicode escapes beyond one byte are not supported");
+            }
+            break;
+        case 'c':
+            if (atEnd() || !((peek() >= 'a' && peek() <= 'z') || (peek() >= 'A' && peek() <= 'Z')))
+            {
+                fail("invalid control escape");
+            }
+            single = peek() % 32;
+            ++position_;
+            break;
+        case 'b':
+            if (!insideClass)
+            {
+                fail("word boundaries are not supported");
+            }
+            single = '\b';
+            break;
+        default:
+            if ((character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z') ||
+                (character >= '0' && character <= '9'))
+            {
+                fail("unsupported escape sequence");
+            }
+            single = static_cast<unsigned char>(character);
+            break;
+        }
+        characters = makeRange(single, single);
+        return single;
+    }
+
+    Builder& builder_;
+    std::string_view pattern_;
+    std::size_t position_;
+};
+
+}
@@ -0,0 +1,366 @@
+#pragma once
+
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/internal/pattern_compiler.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+// Constant expression counterpart of the nfa and dfa modules. Patterns known at compile time are turned into a
+// deterministic automaton held in fixed size arrays, so neither the construction nor the matching allocates memory.
+// Patterns are parsed by the pattern_compiler module, as for the nfa module, and malformed ones surface as compilation
+// errors naming the non constant expression function failPattern. The byte classes and the subset construction below
+// mirror getDfa in the dfa module on fixed size arrays and must be kept in sync with it, which the static_automaton
+// tests check by comparing both automata for the same patterns.
+namespace dansandu::glyph::internal::static_automaton
+{
+
+[[noreturn]] inline void failStaticPattern(const char* const reason)
+{
+    throw dansandu::glyph::error::PatternError{reason};
+}
+
+// Only counts states so that the automaton arrays can be sized exactly before the patterns are compiled for real.
+struct StaticStateCounter
+{
+    constexpr int addState()
+    {
+        return statesCount++;
+    }
+
+    constexpr void setTransition(const int, const dansandu::glyph::internal::pattern_compiler::ByteSet&, const int)
+    {
+    }
+
+    constexpr void addEpsilon(const int, const int)
+    {
+    }
+
+    int statesCount = 0;
+};
+
+// Thompson automaton of all patterns whose states either consume one character or have at most two epsilon
+// transitions. Each pattern has its own start state and the accepted pattern of its final state is its index.
+template<int StatesCount, int PatternsCount>
+struct StaticNfa
+{
+    constexpr int addState()
+    {
+        if (statesCount == StatesCount)
+        {
+            failStaticPattern("static automaton state count mismatch");
+        }
+        next[statesCount] = -1;
+        epsilonTransitions[statesCount] = {-1, -1};
+        acceptedPatterns[statesCount] = -1;
+        return statesCount++;
+    }
+
+    constexpr void setTransition(const int from,
+                                 const dansandu::glyph::internal::pattern_compiler::ByteSet& transitionCharacters,
+                                 const int to)
+    {
+        characters[from] = transitionCharacters;
+        next[from] = to;
+    }
+
+    constexpr void addEpsilon(const int from, const int to)
+    {
+        auto& transitions = epsilonTransitions[from];
+        if (transitions[0] == -1)
+        {
+            transitions[0] = to;
+        }
+        else if (transitions[1] == -1)
+        {
+            transitions[1] = to;
+        }
+        else
+        {
+            failStaticPattern("static automaton state has too many epsilon transitions");
+        }
+    }
+
+    std::array<dansandu::glyph::internal::pattern_compiler::ByteSet, StatesCount> characters{};
+    std::array<int, StatesCount> next{};
+    std::array<std::array<int, 2>, StatesCount> epsilonTransitions{};
+    std::array<int, StatesCount> acceptedPatterns{};
+    std::array<int, PatternsCount> startStates{};
+    int statesCount = 0;
+};
+
+template<typename Patterns>
+constexpr int getStaticNfaStatesCount(const Patterns& patterns)
+{
+    auto counter = StaticStateCounter{};
+    for (const auto pattern : patterns)
+    {
+        dansandu::glyph::internal::pattern_compiler::PatternCompiler<StaticStateCounter>{counter, pattern}.compile();
+    }
+    return counter.statesCount;
+}
+
+template<int StatesCount, int PatternsCount, typename Patterns>
+constexpr StaticNfa<StatesCount, PatternsCount> getStaticNfa(const Patterns& patterns)
+{
+    auto nfa = StaticNfa<StatesCount, PatternsCount>{};
+    for (auto pattern = 0; pattern < PatternsCount; ++pattern)
+    {
+        const auto fragment = dansandu::glyph::internal::pattern_compiler::PatternCompiler<
+                                  StaticNfa<StatesCount, PatternsCount>>{nfa, patterns[pattern]}
+                                  .compile();
+        nfa.startStates[pattern] = fragment.start;
+        nfa.acceptedPatterns[fragment.end] = pattern;
+    }
+    return nfa;
+}
+
+struct StaticByteClasses
+{
+    std::array<int, 256> byteClasses{};
+    int classesCount = 0;
+};
+
+template<typename Nfa>
+constexpr StaticByteClasses getStaticByteClasses(const Nfa& nfa)
+{
+    auto classes = StaticByteClasses{};
+    classes.classesCount = 1;
+    for (auto state = 0; state < nfa.statesCount; ++state)
+    {
+        if (nfa.next[state] == -1)
+        {
+            continue;
+        }
+        auto renumbering = std::array<int, 512>{};
+        for (auto index = 0; index < classes.classesCount * 2; ++index)
+        {
+            renumbering[index] = -1;
+        }
+        auto classesCount = 0;
+        for (auto byte = 0; byte < 256; ++byte)
+        {
+            const auto inSet = dansandu::glyph::internal::pattern_compiler::contains(nfa.characters[state], byte);
+            auto& newClass = renumbering[classes.byteClasses[byte] * 2 + inSet];
+            if (newClass == -1)
+            {
+                newClass = classesCount++;
+            }
+            classes.byteClasses[byte] = newClass;
+        }
+        classes.classesCount = classesCount;
+    }
+    return classes;
+}
+
+// Subset construction working storage. The capacity bounds the number of deterministic states and the states beyond
+// the count are unused, so the result is copied into an exactly sized StaticDfa.
+template<int Words, int ClassesCount, int Capacity>
+struct StaticSubsets
+{
+    std::array<std::array<std::uint64_t, Words>, Capacity> subsets{};
+    std::array<int, Capacity * ClassesCount> transitions{};
+    std::array<int, Capacity> acceptedPatterns{};
+    int statesCount = 0;
+};
+
+template<int Words>
+constexpr bool equalSubsets(const std::array<std::uint64_t, Words>& left, const std::array<std::uint64_t, Words>& right)
+{
+    for (auto word = 0; word < Words; ++word)
+    {
+        if (left[word] != right[word])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<int Words>
+constexpr std::uint64_t hashSubset(const std::array<std::uint64_t, Words>& subset)
+{
+    auto hash = std::uint64_t{14695981039346656037ULL};
+    for (const auto word : subset)
+    {
+        hash = (hash ^ word ^ (word >> 29)) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+template<int ClassesCount, int Capacity, typename Nfa>
+constexpr auto getStaticSubsets(const Nfa& nfa, const StaticByteClasses& classes)
+{
+    constexpr auto statesCount = static_cast<int>(std::tuple_size<decltype(Nfa::next)>::value);
+    constexpr auto words = (statesCount + 63) / 64;
+    using Subset = std::array<std::uint64_t, words>;
+
+    auto closures = std::array<Subset, statesCount>{};
+    for (auto state = 0; state < statesCount; ++state)
+    {
+        auto stack = std::array<int, statesCount>{};
+        auto stackSize = 0;
+        closures[state][state / 64] |= std::uint64_t{1} << (state % 64);
+        stack[stackSize++] = state;
+        while (stackSize > 0)
+        {
+            const auto current = stack[--stackSize];
+            for (const auto next : nfa.epsilonTransitions[current])
+            {
+                if (next != -1 && !((closures[state][next / 64] >> (next % 64)) & 1))
+                {
+                    closures[state][next / 64] |= std::uint64_t{1} << (next % 64);
+                    stack[stackSize++] = next;
+                }
+            }
+        }
+    }
+
+    auto representatives = std::array<int, ClassesCount>{};
+    for (auto byte = 255; byte >= 0; --byte)
+    {
+        representatives[classes.byteClasses[byte]] = byte;
+    }
+
+    auto result = StaticSubsets<words, ClassesCount, Capacity>{};
+    auto table = std::array<int, Capacity * 2>{};
+    for (auto& entry : table)
+    {
+        entry = -1;
+    }
+    const auto findOrAdd = [&result, &table](const Subset& subset)
+    {
+        auto slot = hashSubset<words>(subset) % (Capacity * 2);
+        while (table[slot] != -1)
+        {
+            if (equalSubsets<words>(result.subsets[table[slot]], subset))
+            {
+                return table[slot];
+            }
+            slot = (slot + 1) % (Capacity * 2);
+        }
+        if (result.statesCount == Capacity)
+        {
+            failStaticPattern("static automaton has more states than its capacity");
+        }
+        result.subsets[result.statesCount] = subset;
+        table[slot] = result.statesCount;
+        return result.statesCount++;
+    };
+
+    auto start = Subset{};
+    for (const auto startState : nfa.startStates)
+    {
+        for (auto word = 0; word < words; ++word)
+        {
+            start[word] |= closures[startState][word];
+        }
+    }
+    findOrAdd(start);
+
+    for (auto dfaState = 0; dfaState < result.statesCount; ++dfaState)
+    {
+        const auto subset = result.subsets[dfaState];
+        auto acceptedPattern = -1;
+        for (auto nfaState = 0; nfaState < statesCount; ++nfaState)
+        {
+            const auto pattern = nfa.acceptedPatterns[nfaState];
+            if (((subset[nfaState / 64] >> (nfaState % 64)) & 1) && pattern != -1 &&
+                (acceptedPattern == -1 || pattern < acceptedPattern))
+            {
+                acceptedPattern = pattern;
+            }
+        }
+        result.acceptedPatterns[dfaState] = acceptedPattern;
+
+        for (auto byteClass = 0; byteClass < ClassesCount; ++byteClass)
+        {
+            const auto byte = representatives[byteClass];
+            auto target = Subset{};
+            auto empty = true;
+            for (auto nfaState = 0; nfaState < statesCount; ++nfaState)
+            {
+                const auto next = nfa.next[nfaState];
+                if (((subset[nfaState / 64] >> (nfaState % 64)) & 1) && next != -1 &&
+                    dansandu::glyph::internal::pattern_compiler::contains(nfa.characters[nfaState], byte))
+                {
+                    for (auto word = 0; word < words; ++word)
+                    {
+                        target[word] |= closures[next][word];
+                    }
+                    empty = false;
+                }
+            }
+            result.transitions[dfaState * ClassesCount + byteClass] = empty ? -1 : findOrAdd(target);
+        }
+    }
+    return result;
+}
+
+// Same layout and meaning as the runtime Dfa, see the dfa module.
+template<int StatesCount, int ClassesCount>
+struct StaticDfa
+{
+    std::array<int, 256> byteClasses{};
+    std::array<int, StatesCount * ClassesCount> transitions{};
+    std::array<int, StatesCount> acceptedPatterns{};
+    std::array<int, StatesCount> reachablePatterns{};
+};
+
+template<int StatesCount, int ClassesCount, typename Subsets>
+constexpr StaticDfa<StatesCount, ClassesCount> getStaticDfa(const Subsets& subsets, const StaticByteClasses& classes)
+{
+    auto dfa = StaticDfa<StatesCount, ClassesCount>{};
+    dfa.byteClasses = classes.byteClasses;
+    for (auto index = 0; index < StatesCount * ClassesCount; ++index)
+    {
+        dfa.transitions[index] = subsets.transitions[index];
+    }
+    for (auto state = 0; state < StatesCount; ++state)
+    {
+        dfa.acceptedPatterns[state] = subsets.acceptedPatterns[state];
+        dfa.reachablePatterns[state] = subsets.acceptedPatterns[state];
+    }
+
+    auto changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (auto state = 0; state < StatesCount; ++state)
+        {
+            auto& reachable = dfa.reachablePatterns[state];
+            for (auto byteClass = 0; byteClass < ClassesCount; ++byteClass)
+            {
+                const auto next = dfa.transitions[state * ClassesCount + byteClass];
+                const auto nextReachable = next != -1 ? dfa.reachablePatterns[next] : -1;
+                if (nextReachable != -1 && (reachable == -1 || nextReachable < reachable))
+                {
+                    reachable = nextReachable;
+                    changed = true;
+                }
+            }
+        }
+    }
+    return dfa;
+}
+
+// Builds the automaton of a constant array of patterns, such as a constexpr std::string_view array, in stages so that
+// each stage can size its arrays from the previous one. Only the final dfa is used at runtime.
+template<const auto& Patterns, int Capacity>
+struct StaticAutomaton
+{
+    static constexpr auto patternsCount = static_cast<int>(std::size(Patterns));
+
+    static constexpr auto nfa = getStaticNfa<getStaticNfaStatesCount(Patterns), patternsCount>(Patterns);
+
+    static constexpr auto classes = getStaticByteClasses(nfa);
+
+    static constexpr auto subsets = getStaticSubsets<classes.classesCount, Capacity>(nfa, classes);
+
+    static constexpr auto dfa = getStaticDfa<subsets.statesCount, classes.classesCount>(subsets, classes);
+};
+
+}
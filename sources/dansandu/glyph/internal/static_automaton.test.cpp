@@ -0,0 +1,113 @@
+#include "dansandu/glyph/internal/static_automaton.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/internal/dfa.hpp"
+#include "dansandu/glyph/internal/nfa.hpp"
+
+#include <iterator>
+#include <set>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::internal::dfa::Dfa;
+using dansandu::glyph::internal::dfa::getDfa;
+using dansandu::glyph::internal::nfa::getNfa;
+using dansandu::glyph::internal::nfa::Nfa;
+using dansandu::glyph::internal::static_automaton::StaticAutomaton;
+
+static constexpr std::string_view tokenPatterns[] = {
+    "if",
+    "[a-z_]\\w*",
+    "(?:0|[1-9]\\d*)(?:\\.\\d+)?(?:[eE][+\\-]?\\d{1,3})?",
+    "\"(?:[^\"\\\\\\n]|\\\\.)*\"",
+    "\\+|-|\\*|/|==?",
+    "\\s+"
+};
+
+static constexpr std::string_view syntaxPatterns[] = {
+    "a\\+\\.\\x41\\t",
+    "[a-c_][^0-9\\s]\\d\\w\\S.",
+    "a*b+c?d{2}e{1,2}f{2,}",
+    "(?:ab|a)(?:bc)*",
+    "[^a]{0,2}x"
+};
+
+template<const auto& Patterns>
+static Dfa getRuntimeDfa()
+{
+    auto nfas = std::vector<Nfa>{};
+    for (const auto pattern : Patterns)
+    {
+        nfas.push_back(getNfa(pattern));
+    }
+    return getDfa(nfas);
+}
+
+// Walks both automata in lockstep over every byte and checks that each pair of states reached by the same input
+// accepts the same pattern and can still reach the same patterns.
+template<typename Automaton>
+static bool isEquivalent(const Dfa& dfa)
+{
+    const auto& staticDfa = Automaton::dfa;
+    const auto staticClassesCount = Automaton::classes.classesCount;
+    auto visited = std::set<std::pair<int, int>>{{0, 0}};
+    auto pending = std::vector<std::pair<int, int>>{{0, 0}};
+    while (!pending.empty())
+    {
+        const auto [state, staticState] = pending.back();
+        pending.pop_back();
+        if (dfa.acceptedPatterns[state] != staticDfa.acceptedPatterns[staticState] ||
+            dfa.reachablePatterns[state] != staticDfa.reachablePatterns[staticState])
+        {
+            return false;
+        }
+        for (auto byte = 0; byte < 256; ++byte)
+        {
+            const auto next = dfa.transitions[state * dfa.classesCount + dfa.byteClasses[byte]];
+            const auto staticNext =
+                staticDfa.transitions[staticState * staticClassesCount + staticDfa.byteClasses[byte]];
+            if ((next == -1) != (staticNext == -1))
+            {
+                return false;
+            }
+            if (next != -1 && visited.insert({next, staticNext}).second)
+            {
+                pending.push_back({next, staticNext});
+            }
+        }
+    }
+    return true;
+}
+
+TEST_CASE("StaticAutomaton")
+{
+    SECTION("token patterns")
+    {
+        using Automaton = StaticAutomaton<tokenPatterns, 512>;
+
+        const auto dfa = getRuntimeDfa<tokenPatterns>();
+
+        REQUIRE(isEquivalent<Automaton>(dfa));
+
+        REQUIRE(static_cast<int>(dfa.acceptedPatterns.size()) == Automaton::subsets.statesCount);
+
+        REQUIRE(dfa.classesCount == Automaton::classes.classesCount);
+    }
+
+    SECTION("pattern syntax")
+    {
+        using Automaton = StaticAutomaton<syntaxPatterns, 512>;
+
+        const auto dfa = getRuntimeDfa<syntaxPatterns>();
+
+        REQUIRE(Automaton::patternsCount == static_cast<int>(std::size(syntaxPatterns)));
+
+        REQUIRE(isEquivalent<Automaton>(dfa));
+
+        REQUIRE(!isEquivalent<Automaton>(getRuntimeDfa<tokenPatterns>()));
+
+        REQUIRE(static_cast<int>(dfa.acceptedPatterns.size()) == Automaton::subsets.statesCount);
+
+        REQUIRE(dfa.classesCount == Automaton::classes.classesCount);
+    }
+}
@@ -0,0 +1,185 @@
+#include "dansandu/glyph/internal/symbol_set.hpp"
+#include "dansandu/ballotin/exception.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::symbol::Symbol;
+
+namespace dansandu::glyph::internal::symbol_set
+{
+
+static int countBits(const std::uint64_t word)
+{
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt64(word));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+static int getLowestBit(const std::uint64_t word)
+{
+#if defined(_MSC_VER)
+    auto index = 0UL;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+Symbol SymbolSet::Iterator::operator*() const
+{
+    return Symbol{set_->beginIndex_ + word_ * 64 + getLowestBit(bits_)};
+}
+
+SymbolSet::SymbolSet(const Grammar& grammar)
+    : beginIndex_{grammar.getEndOfStringSymbol().getIdentifierIndex()},
+      words_((grammar.getIdentifiers().size() - beginIndex_ + 63) / 64)
+{
+}
+
+bool SymbolSet::insert(const Symbol symbol)
+{
+    const auto bit = symbol.getIdentifierIndex() - beginIndex_;
+    if (bit < 0 || bit / 64 >= static_cast<int>(words_.size()))
+    {
+        THROW(std::out_of_range, "symbol ", symbol, " is outside the universe of the set");
+    }
+    auto& word = words_[bit / 64];
+    const auto mask = std::uint64_t{1} << (bit % 64);
+    const auto inserted = (word & mask) == 0;
+    word |= mask;
+    return inserted;
+}
+
+void SymbolSet::erase(const Symbol symbol)
+{
+    if (contains(symbol))
+    {
+        const auto bit = symbol.getIdentifierIndex() - beginIndex_;
+        words_[bit / 64] &= ~(std::uint64_t{1} << (bit % 64));
+    }
+}
+
+bool SymbolSet::empty() const
+{
+    return std::all_of(words_.cbegin(), words_.cend(), [](const auto word) { return word == 0; });
+}
+
+int SymbolSet::size() const
+{
+    auto count = 0;
+    for (const auto word : words_)
+    {
+        count += countBits(word);
+    }
+    return count;
+}
+
+bool SymbolSet::intersects(const SymbolSet& other) const
+{
+    const auto wordsCount = std::min(words_.size(), other.words_.size());
+    for (auto word = std::size_t{0}; word < wordsCount; ++word)
+    {
+        if ((words_[word] & other.words_[word]) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+SymbolSet& SymbolSet::operator|=(const SymbolSet& other)
+{
+    if (words_.size() < other.words_.size())
+    {
+        beginIndex_ = other.beginIndex_;
+        words_.resize(other.words_.size());
+    }
+    for (auto word = std::size_t{0}; word < other.words_.size(); ++word)
+    {
+        words_[word] |= other.words_[word];
+    }
+    return *this;
+}
+
+SymbolSet& SymbolSet::operator&=(const SymbolSet& other)
+{
+    for (auto word = std::size_t{0}; word < words_.size(); ++word)
+    {
+        words_[word] &= word < other.words_.size() ? other.words_[word] : 0;
+    }
+    return *this;
+}
+
+SymbolSet& SymbolSet::operator-=(const SymbolSet& other)
+{
+    const auto wordsCount = std::min(words_.size(), other.words_.size());
+    for (auto word = std::size_t{0}; word < wordsCount; ++word)
+    {
+        words_[word] &= ~other.words_[word];
+    }
+    return *this;
+}
+
+std::size_t SymbolSet::hash() const
+{
+    auto hash = hashSeed;
+    for (auto word = std::size_t{0}; word < words_.size(); ++word)
+    {
+        if (words_[word] != 0)
+        {
+            hash = hashCombine(hash ^ word, words_[word]);
+        }
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+bool operator==(const SymbolSet& left, const SymbolSet& right)
+{
+    const auto& longer = left.words_.size() < right.words_.size() ? right.words_ : left.words_;
+    const auto& shorter = left.words_.size() < right.words_.size() ? left.words_ : right.words_;
+    return std::equal(shorter.cbegin(), shorter.cend(), longer.cbegin()) &&
+           std::all_of(longer.cbegin() + shorter.size(), longer.cend(), [](const auto word) { return word == 0; });
+}
+
+bool operator<(const SymbolSet& left, const SymbolSet& right)
+{
+    const auto wordsCount = std::max(left.words_.size(), right.words_.size());
+    for (auto word = std::size_t{0}; word < wordsCount; ++word)
+    {
+        const auto leftWord = word < left.words_.size() ? left.words_[word] : 0;
+        const auto rightWord = word < right.words_.size() ? right.words_[word] : 0;
+        if (leftWord != rightWord)
+        {
+            return leftWord < rightWord;
+        }
+    }
+    return false;
+}
+
+std::ostream& operator<<(std::ostream& stream, const SymbolSet& set)
+{
+    stream << "SymbolSet(";
+    auto first = true;
+    for (const auto symbol : set)
+    {
+        stream << (first ? "" : ", ") << symbol;
+        first = false;
+    }
+    return stream << ")";
+}
+
+}
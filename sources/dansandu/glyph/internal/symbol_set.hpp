@@ -0,0 +1,171 @@
+#pragma once
+
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+namespace dansandu::glyph::internal::symbol_set
+{
+
+// Set of terminals, including the end of string and empty symbols, stored as one bit per terminal so that membership,
+// union and intersection work a word at a time. Sets are only combined with sets of the same grammar. A default
+// constructed set is empty and adopts the universe of the first set united into it. Inserting a symbol outside the
+// universe of the set, which includes any symbol for a default constructed set, throws std::out_of_range.
+class SymbolSet
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = dansandu::glyph::symbol::Symbol;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const dansandu::glyph::symbol::Symbol*;
+        using reference = dansandu::glyph::symbol::Symbol;
+
+        Iterator(const SymbolSet& set, const int word) : set_{&set}, word_{word}, bits_{0}
+        {
+            if (word_ < static_cast<int>(set_->words_.size()))
+            {
+                bits_ = set_->words_[word_];
+                skipEmptyWords();
+            }
+        }
+
+        dansandu::glyph::symbol::Symbol operator*() const;
+
+        Iterator& operator++()
+        {
+            bits_ &= bits_ - 1;
+            skipEmptyWords();
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return (word_ == other.word_) & (bits_ == other.bits_);
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        void skipEmptyWords()
+        {
+            while (bits_ == 0 && ++word_ < static_cast<int>(set_->words_.size()))
+            {
+                bits_ = set_->words_[word_];
+            }
+        }
+
+        const SymbolSet* set_;
+        int word_;
+        std::uint64_t bits_;
+    };
+
+    SymbolSet() : beginIndex_{0}
+    {
+    }
+
+    explicit SymbolSet(const dansandu::glyph::internal::grammar::Grammar& grammar);
+
+    bool contains(const dansandu::glyph::symbol::Symbol symbol) const
+    {
+        const auto bit = symbol.getIdentifierIndex() - beginIndex_;
+        return bit >= 0 && bit / 64 < static_cast<int>(words_.size()) && ((words_[bit / 64] >> (bit % 64)) & 1);
+    }
+
+    // Yields true if the symbol wasn't already in the set.
+    bool insert(const dansandu::glyph::symbol::Symbol symbol);
+
+    void erase(const dansandu::glyph::symbol::Symbol symbol);
+
+    bool empty() const;
+
+    int size() const;
+
+    bool intersects(const SymbolSet& other) const;
+
+    SymbolSet& operator|=(const SymbolSet& other);
+
+    SymbolSet& operator&=(const SymbolSet& other);
+
+    SymbolSet& operator-=(const SymbolSet& other);
+
+    Iterator begin() const
+    {
+        return Iterator{*this, 0};
+    }
+
+    Iterator end() const
+    {
+        return Iterator{*this, static_cast<int>(words_.size())};
+    }
+
+    Iterator cbegin() const
+    {
+        return begin();
+    }
+
+    Iterator cend() const
+    {
+        return end();
+    }
+
+    std::vector<dansandu::glyph::symbol::Symbol> getSymbols() const
+    {
+        return {begin(), end()};
+    }
+
+    std::size_t hash() const;
+
+    friend bool operator==(const SymbolSet& left, const SymbolSet& right);
+
+    // Orders sets by their words, so that sets differing only in trailing empty words are equivalent.
+    friend bool operator<(const SymbolSet& left, const SymbolSet& right);
+
+private:
+    int beginIndex_;
+    std::vector<std::uint64_t> words_;
+};
+
+inline bool operator!=(const SymbolSet& left, const SymbolSet& right)
+{
+    return !(left == right);
+}
+
+std::ostream& operator<<(std::ostream& stream, const SymbolSet& set);
+
+// Initial state of the FNV-1a hashes built with hashCombine.
+constexpr auto hashSeed = std::uint64_t{14695981039346656037ULL};
+
+// Folds a value into an FNV-1a hash. The value is xored with its own high bits first, since values packed from small
+// indices would otherwise leave the upper bits of the product untouched.
+constexpr std::uint64_t hashCombine(const std::uint64_t hash, const std::uint64_t value)
+{
+    return (hash ^ value ^ (value >> 29)) * 1099511628211ULL;
+}
+
+}
+
+namespace std
+{
+
+template<>
+struct hash<dansandu::glyph::internal::symbol_set::SymbolSet>
+{
+    std::size_t operator()(const dansandu::glyph::internal::symbol_set::SymbolSet& set) const
+    {
+        return set.hash();
+    }
+};
+
+}
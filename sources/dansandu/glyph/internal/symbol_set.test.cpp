@@ -0,0 +1,148 @@
+#include "dansandu/glyph/internal/symbol_set.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/symbol.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::symbol_set::SymbolSet;
+using dansandu::glyph::symbol::Symbol;
+
+TEST_CASE("SymbolSet")
+{
+    auto text = std::string{"Start -> List\nList -> List Item\nList -> Item\n"};
+    for (auto index = 0; index < 100; ++index)
+    {
+        text += "Item -> t" + std::to_string(index) + "\n";
+    }
+    const auto grammar = Grammar{text};
+
+    const auto end = grammar.getEndOfStringSymbol();
+    const auto empty = grammar.getEmptySymbol();
+    const auto t0 = grammar.getTerminalSymbol("t0");
+    const auto t63 = grammar.getTerminalSymbol("t63");
+    const auto t99 = grammar.getTerminalSymbol("t99");
+
+    auto set = SymbolSet{grammar};
+
+    SECTION("empty")
+    {
+        REQUIRE(set.empty());
+
+        REQUIRE(set.size() == 0);
+
+        REQUIRE(set.begin() == set.end());
+
+        REQUIRE(!set.contains(end));
+
+        REQUIRE(!set.contains(grammar.getStartSymbol()));
+
+        REQUIRE(set == SymbolSet{});
+    }
+
+    SECTION("insertion")
+    {
+        REQUIRE(set.insert(t99));
+
+        REQUIRE(set.insert(end));
+
+        REQUIRE(set.insert(t63));
+
+        REQUIRE(!set.insert(t63));
+
+        REQUIRE(set.contains(t63));
+
+        REQUIRE(!set.contains(t0));
+
+        REQUIRE(set.size() == 3);
+
+        REQUIRE(set.getSymbols() == std::vector<Symbol>{end, t63, t99});
+
+        set.erase(t63);
+
+        set.erase(t0);
+
+        REQUIRE(set.getSymbols() == std::vector<Symbol>{end, t99});
+
+        REQUIRE_THROWS_AS(set.insert(grammar.getStartSymbol()), std::out_of_range);
+
+        auto unsized = SymbolSet{};
+
+        REQUIRE_THROWS_AS(unsized.insert(end), std::out_of_range);
+
+        REQUIRE(!unsized.contains(end));
+    }
+
+    SECTION("set operations")
+    {
+        set.insert(empty);
+        set.insert(t0);
+        set.insert(t63);
+
+        auto other = SymbolSet{grammar};
+        other.insert(t63);
+        other.insert(t99);
+
+        REQUIRE(set.intersects(other));
+
+        auto united = set;
+        united |= other;
+
+        REQUIRE(united.getSymbols() == std::vector<Symbol>{empty, t0, t63, t99});
+
+        auto intersected = set;
+        intersected &= other;
+
+        REQUIRE(intersected.getSymbols() == std::vector<Symbol>{t63});
+
+        auto subtracted = set;
+        subtracted -= other;
+
+        REQUIRE(subtracted.getSymbols() == std::vector<Symbol>{empty, t0});
+
+        REQUIRE(!subtracted.intersects(other));
+
+        auto adopted = SymbolSet{};
+        adopted |= other;
+
+        REQUIRE(adopted == other);
+    }
+
+    SECTION("hashing")
+    {
+        set.insert(t0);
+        set.insert(t99);
+
+        auto other = SymbolSet{grammar};
+        other.insert(t99);
+        other.insert(t0);
+
+        REQUIRE(set == other);
+
+        REQUIRE(set.hash() == other.hash());
+
+        REQUIRE(std::unordered_set<SymbolSet>{set, other}.size() == 1);
+    }
+
+    SECTION("ordering")
+    {
+        REQUIRE(!(set < SymbolSet{}));
+
+        REQUIRE(!(SymbolSet{} < set));
+
+        auto other = SymbolSet{grammar};
+        other.insert(t0);
+
+        REQUIRE(set < other);
+
+        REQUIRE(!(other < set));
+
+        set.insert(t99);
+
+        REQUIRE((set < other) != (other < set));
+    }
+}
@@ -2,15 +2,16 @@
 #include "dansandu/ballotin/exception.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <string>
 #include <string_view>
 
 namespace dansandu::glyph::internal::text_location
 {
 
-TextLocation getTextLocation(const std::string_view text, const int tokenBegin, const int tokenEnd)
+TextLocation getTextLocation(const std::string_view text, const std::int64_t tokenBegin, const std::int64_t tokenEnd)
 {
-    const auto textSize = static_cast<int>(text.size());
+    const auto textSize = static_cast<std::int64_t>(text.size());
 
     if (tokenBegin < 0 || tokenBegin > textSize || tokenEnd < 0 || tokenEnd > textSize || tokenBegin > tokenEnd)
     {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 
@@ -8,11 +9,11 @@ namespace dansandu::glyph::internal::text_location
 
 struct TextLocation
 {
-    int lineNumber;
-    int columnNumber;
+    std::int64_t lineNumber;
+    std::int64_t columnNumber;
     std::string highlight;
 };
 
-TextLocation getTextLocation(const std::string_view text, const int tokenBegin, const int tokenEnd);
+TextLocation getTextLocation(const std::string_view text, const std::int64_t tokenBegin, const std::int64_t tokenEnd);
 
 }
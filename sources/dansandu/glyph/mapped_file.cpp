@@ -0,0 +1,136 @@
+#include "dansandu/glyph/mapped_file.hpp"
+#include "dansandu/ballotin/exception.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dansandu::glyph::mapped_file
+{
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) : data_{nullptr}, size_{0}
+{
+    const auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        THROW(std::runtime_error, "could not open file '", path, "'");
+    }
+
+    auto fileSize = LARGE_INTEGER{};
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        THROW(std::runtime_error, "could not get the size of file '", path, "'");
+    }
+
+    size_ = static_cast<std::int64_t>(fileSize.QuadPart);
+    if (size_ == 0)
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    const auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        THROW(std::runtime_error, "could not create a mapping of file '", path, "'");
+    }
+
+    data_ = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (data_ == nullptr)
+    {
+        THROW(std::runtime_error, "could not map file '", path, "'");
+    }
+}
+
+void MappedFile::unmap() noexcept
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) : data_{nullptr}, size_{0}
+{
+    const auto file = open(path.c_str(), O_RDONLY);
+    if (file == -1)
+    {
+        THROW(std::runtime_error, "could not open file '", path, "'");
+    }
+
+    struct stat status;
+    if (fstat(file, &status) == -1)
+    {
+        close(file);
+        THROW(std::runtime_error, "could not get the size of file '", path, "'");
+    }
+
+    size_ = static_cast<std::int64_t>(status.st_size);
+    if (size_ == 0)
+    {
+        close(file);
+        return;
+    }
+
+    const auto address = mmap(nullptr, static_cast<std::size_t>(size_), PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (address == MAP_FAILED)
+    {
+        THROW(std::runtime_error, "could not map file '", path, "'");
+    }
+
+    madvise(address, static_cast<std::size_t>(size_), MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(address);
+}
+
+void MappedFile::unmap() noexcept
+{
+    if (data_ != nullptr)
+    {
+        munmap(const_cast<char*>(data_), static_cast<std::size_t>(size_));
+    }
+}
+
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)}
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+}
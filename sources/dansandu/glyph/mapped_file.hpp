@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace dansandu::glyph::mapped_file
+{
+
+// Maps a file read-only into memory so it can be tokenized and parsed without copying it into a string. The text
+// stays valid for as long as the object is alive.
+class PRALINE_EXPORT MappedFile
+{
+public:
+    explicit MappedFile(const std::string& path);
+
+    MappedFile(MappedFile&& other) noexcept;
+
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    std::string_view getText() const noexcept
+    {
+        return {data_, static_cast<std::size_t>(size_)};
+    }
+
+private:
+    void unmap() noexcept;
+
+    const char* data_;
+    std::int64_t size_;
+};
+
+}
@@ -0,0 +1,63 @@
+#include "dansandu/glyph/mapped_file.hpp"
+#include "catchorg/catch/catch.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using dansandu::glyph::mapped_file::MappedFile;
+
+static std::string writeTemporaryFile(const std::string& name, const std::string& content)
+{
+    const auto path = (std::filesystem::temp_directory_path() / name).string();
+    auto stream = std::ofstream{path, std::ios::binary};
+    stream << content;
+    return path;
+}
+
+TEST_CASE("MappedFile")
+{
+    SECTION("file content")
+    {
+        const auto path = writeTemporaryFile("glyph_mapped_file_content.txt", "a + b\n* c");
+        {
+            const auto file = MappedFile{path};
+
+            REQUIRE(file.getText() == "a + b\n* c");
+        }
+        std::remove(path.c_str());
+    }
+
+    SECTION("empty file")
+    {
+        const auto path = writeTemporaryFile("glyph_mapped_file_empty.txt", "");
+        {
+            const auto file = MappedFile{path};
+
+            REQUIRE(file.getText().empty());
+        }
+        std::remove(path.c_str());
+    }
+
+    SECTION("move")
+    {
+        const auto path = writeTemporaryFile("glyph_mapped_file_move.txt", "abc");
+        {
+            auto file = MappedFile{path};
+            auto other = std::move(file);
+
+            REQUIRE(file.getText().empty());
+
+            REQUIRE(other.getText() == "abc");
+        }
+        std::remove(path.c_str());
+    }
+
+    SECTION("missing file")
+    {
+        REQUIRE_THROWS_AS(MappedFile{"glyph_missing_directory/missing_file.txt"}, std::runtime_error);
+    }
+}
@@ -0,0 +1,203 @@
+#include "dansandu/glyph/parallel_tokenizer.hpp"
+#include "dansandu/ballotin/exception.hpp"
+#include "dansandu/glyph/token.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::ITokenizer;
+using dansandu::glyph::tokenizer::ITokenStream;
+
+namespace dansandu::glyph::parallel_tokenizer
+{
+
+struct Chunk
+{
+    std::int64_t begin;
+    std::int64_t end;
+    std::vector<Token> tokens;
+    bool exhausted;
+    std::exception_ptr failure;
+};
+
+static std::vector<Chunk> getChunks(const std::string_view text, const std::int64_t chunkSize,
+                                    const std::string_view synchronizationCharacters)
+{
+    const auto textSize = static_cast<std::int64_t>(text.size());
+    auto chunks = std::vector<Chunk>{};
+    auto begin = std::int64_t{0};
+    while (begin < textSize)
+    {
+        auto end = textSize;
+        if (begin + chunkSize < textSize)
+        {
+            const auto synchronization = text.find_first_of(synchronizationCharacters, begin + chunkSize);
+            if (synchronization != std::string_view::npos)
+            {
+                end = static_cast<std::int64_t>(synchronization) + 1;
+            }
+        }
+        chunks.push_back({begin, end, {}, false, nullptr});
+        begin = end;
+    }
+    return chunks;
+}
+
+// Tokenizes from the beginning of the chunk until a token reaches the end of the chunk, which might already be part of
+// the next chunk.
+static void tokenizeChunk(const ITokenizer& tokenizer, const std::string_view text, Chunk& chunk)
+{
+    try
+    {
+        const auto stream = tokenizer.getTokenStream(text.substr(chunk.begin));
+        while (true)
+        {
+            const auto token = stream->nextToken();
+            if (!token)
+            {
+                chunk.exhausted = true;
+                break;
+            }
+            chunk.tokens.push_back({token->getSymbol(), token->begin() + chunk.begin, token->end() + chunk.begin});
+            if (chunk.tokens.back().end() >= chunk.end)
+            {
+                break;
+            }
+        }
+    }
+    catch (...)
+    {
+        // Exceptions can't leave the worker thread, the serial rescan reports them from the calling thread instead.
+        chunk.tokens.clear();
+        chunk.failure = std::current_exception();
+    }
+}
+
+// Yields the index of the first chunk token following the given position if the chunk scan had a token end there.
+static std::optional<std::size_t> getResumption(const Chunk& chunk, const std::int64_t position)
+{
+    if (chunk.failure)
+    {
+        return std::nullopt;
+    }
+    if (position == chunk.begin)
+    {
+        return 0;
+    }
+    const auto match = std::lower_bound(chunk.tokens.cbegin(), chunk.tokens.cend(), position,
+                                        [](const Token& token, const std::int64_t end) { return token.end() < end; });
+    if (match != chunk.tokens.cend() && match->end() == position)
+    {
+        return match - chunk.tokens.cbegin() + 1;
+    }
+    return std::nullopt;
+}
+
+static void stitch(const ITokenizer& tokenizer, const std::string_view text, const std::vector<Chunk>& chunks,
+                   std::vector<Token>& tokens)
+{
+    const auto textSize = static_cast<std::int64_t>(text.size());
+    auto position = std::int64_t{0};
+    auto stream = std::unique_ptr<ITokenStream>{};
+    auto streamOffset = std::int64_t{0};
+    for (const auto& chunk : chunks)
+    {
+        while (position < chunk.end)
+        {
+            if (const auto resumption = getResumption(chunk, position))
+            {
+                tokens.insert(tokens.end(), chunk.tokens.cbegin() + *resumption, chunk.tokens.cend());
+                position = chunk.exhausted ? textSize : chunk.tokens.back().end();
+                stream.reset();
+                continue;
+            }
+
+            if (!stream)
+            {
+                stream = tokenizer.getTokenStream(text.substr(position));
+                streamOffset = position;
+            }
+            const auto token = stream->nextToken();
+            if (!token)
+            {
+                position = textSize;
+                continue;
+            }
+            tokens.push_back({token->getSymbol(), token->begin() + streamOffset, token->end() + streamOffset});
+            position = tokens.back().end();
+        }
+    }
+}
+
+ParallelTokenizer::ParallelTokenizer(const ITokenizer& tokenizer, const int threadsCount, const std::int64_t chunkSize,
+                                     const std::string_view synchronizationCharacters)
+    : tokenizer_{tokenizer},
+      threadsCount_{std::max(1, threadsCount > 0 ? threadsCount : static_cast<int>(std::thread::hardware_concurrency()))},
+      chunkSize_{chunkSize},
+      synchronizationCharacters_{synchronizationCharacters}
+{
+    if (chunkSize_ <= 0)
+    {
+        THROW(std::invalid_argument, "chunk size must be positive, got ", chunkSize_);
+    }
+}
+
+std::vector<Token> ParallelTokenizer::tokenize(const std::string_view text) const
+{
+    auto tokens = std::vector<Token>{};
+    tokenize(text, tokens);
+    return tokens;
+}
+
+void ParallelTokenizer::tokenize(const std::string_view text, std::vector<Token>& tokens) const
+{
+    auto chunks = getChunks(text, chunkSize_, synchronizationCharacters_);
+    if (chunks.size() <= 1 || threadsCount_ == 1)
+    {
+        tokenizer_.tokenize(text, tokens);
+        return;
+    }
+
+    auto nextChunk = std::atomic<int>{0};
+    const auto worker = [this, text, &chunks, &nextChunk]()
+    {
+        for (auto index = nextChunk++; index < static_cast<int>(chunks.size()); index = nextChunk++)
+        {
+            tokenizeChunk(tokenizer_, text, chunks[index]);
+        }
+    };
+    auto threads = std::vector<std::thread>{};
+    const auto threadsCount = std::min(threadsCount_, static_cast<int>(chunks.size()));
+    for (auto thread = 1; thread < threadsCount; ++thread)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto tokensCount = tokens.size();
+    try
+    {
+        stitch(tokenizer_, text, chunks, tokens);
+    }
+    catch (...)
+    {
+        // The serial scan reports the error with its location in the whole text rather than in a chunk.
+        tokens.erase(tokens.begin() + tokensCount, tokens.end());
+        tokenizer_.tokenize(text, tokens);
+    }
+}
+
+}
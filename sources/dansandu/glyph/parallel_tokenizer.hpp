@@ -0,0 +1,40 @@
+#pragma once
+
+#include "dansandu/glyph/token.hpp"
+#include "dansandu/glyph/tokenizer.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dansandu::glyph::parallel_tokenizer
+{
+
+// Splits large texts into chunks that start right after a synchronization character, typically a newline, and
+// tokenizes them concurrently with the wrapped tokenizer. Each chunk is read from the token stream of the wrapped
+// tokenizer so tokens crossing the chunk end are matched in full. Chunks are then stitched together in order: where a
+// chunk didn't start on a token boundary of the serial scan, the text is rescanned from the previous token until both
+// scans agree on a token end. The result is therefore the same as the serial one provided the wrapped tokenizer only
+// looks at the text following the token being matched. The wrapped tokenizer must outlive this one and its tokenize
+// and getTokenStream methods must be safe to call from several threads at once.
+class PRALINE_EXPORT ParallelTokenizer : public dansandu::glyph::tokenizer::ITokenizer
+{
+public:
+    explicit ParallelTokenizer(const dansandu::glyph::tokenizer::ITokenizer& tokenizer, const int threadsCount = 0,
+                               const std::int64_t chunkSize = 1 << 20,
+                               const std::string_view synchronizationCharacters = "\n");
+
+    std::vector<dansandu::glyph::token::Token> tokenize(const std::string_view text) const override;
+
+    // Stitches the chunks directly into the buffer.
+    void tokenize(const std::string_view text, std::vector<dansandu::glyph::token::Token>& tokens) const override;
+
+private:
+    const dansandu::glyph::tokenizer::ITokenizer& tokenizer_;
+    int threadsCount_;
+    std::int64_t chunkSize_;
+    std::string synchronizationCharacters_;
+};
+
+}
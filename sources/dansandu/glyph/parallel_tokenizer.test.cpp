@@ -0,0 +1,166 @@
+#include "dansandu/glyph/parallel_tokenizer.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/dfa_tokenizer.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/regex_tokenizer.hpp"
+#include "dansandu/glyph/token.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::dfa_tokenizer::DfaTokenizer;
+using dansandu::glyph::error::TokenizationError;
+using dansandu::glyph::parallel_tokenizer::ParallelTokenizer;
+using dansandu::glyph::regex_tokenizer::RegexTokenizer;
+using dansandu::glyph::symbol::Symbol;
+using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::ITokenizer;
+using dansandu::glyph::tokenizer::TokenizationMode;
+
+// Yields a token per line and throws an exception that isn't a std::exception on lines starting with '@'.
+class LineTokenizer : public ITokenizer
+{
+public:
+    using ITokenizer::tokenize;
+
+    std::vector<Token> tokenize(const std::string_view text) const override
+    {
+        auto tokens = std::vector<Token>{};
+        for (auto begin = std::size_t{0}; begin < text.size();)
+        {
+            if (text[begin] == '@')
+            {
+                throw static_cast<int>(begin);
+            }
+            const auto end = std::min(text.find('\n', begin), text.size() - 1) + 1;
+            tokens.push_back({Symbol{2}, static_cast<std::int64_t>(begin), static_cast<std::int64_t>(end)});
+            begin = end;
+        }
+        return tokens;
+    }
+};
+
+static std::string getErrorMessage(const ParallelTokenizer& tokenizer, const std::string_view text)
+{
+    try
+    {
+        tokenizer.tokenize(text);
+    }
+    catch (const TokenizationError& error)
+    {
+        return error.what();
+    }
+    return {};
+}
+
+TEST_CASE("ParallelTokenizer")
+{
+    const auto identifier = Symbol{2};
+    const auto string     = Symbol{3};
+    const auto whitespace = Symbol{4};
+
+    const auto descriptors = std::vector<std::pair<Symbol, std::string_view>>{
+        {identifier, "[a-z]+"},
+        {string,     "\"[^\"]*\""},
+        {whitespace, "\\s+"}
+    };
+
+    const auto text = std::string{"abc \"multi\nline\nstring\" def\n\n\n   ghi\n\"x\" \"\n\" jkl\nmno pqr\n"};
+
+    SECTION("dfa tokenizer")
+    {
+        const auto serial = DfaTokenizer{descriptors};
+        const auto expected = serial.tokenize(text);
+
+        for (auto chunkSize = 1; chunkSize <= static_cast<int>(text.size()) + 1; ++chunkSize)
+        {
+            REQUIRE(ParallelTokenizer{serial, 4, chunkSize}.tokenize(text) == expected);
+
+            REQUIRE(ParallelTokenizer{serial, 3, chunkSize, "\n\""}.tokenize(text) == expected);
+        }
+    }
+
+    SECTION("token buffer")
+    {
+        const auto serial = DfaTokenizer{descriptors};
+        const auto parallel = ParallelTokenizer{serial, 4, 8};
+
+        auto tokens = std::vector<Token>{Token{string, 0, 1}};
+
+        parallel.tokenize(text, tokens);
+
+        auto expected = std::vector<Token>{Token{string, 0, 1}};
+        serial.tokenize(text, expected);
+
+        REQUIRE(tokens == expected);
+
+        REQUIRE_THROWS_AS(parallel.tokenize("abc\ndef\nghi @\njkl\n", tokens), TokenizationError);
+    }
+
+    SECTION("regex tokenizer")
+    {
+        const auto serial = RegexTokenizer{descriptors};
+        const auto expected = serial.tokenize(text);
+
+        for (auto chunkSize = 1; chunkSize <= static_cast<int>(text.size()) + 1; ++chunkSize)
+        {
+            REQUIRE(ParallelTokenizer{serial, 4, chunkSize}.tokenize(text) == expected);
+        }
+    }
+
+    SECTION("skipped characters")
+    {
+        const auto serial =
+            DfaTokenizer{{{identifier, "[a-z]+"}, {string, "\"[^\"]*\""}}, TokenizationMode::contextFree, " \n"};
+        const auto expected = serial.tokenize(text);
+
+        for (auto chunkSize = 1; chunkSize <= static_cast<int>(text.size()) + 1; ++chunkSize)
+        {
+            REQUIRE(ParallelTokenizer{serial, 2, chunkSize}.tokenize(text) == expected);
+        }
+    }
+
+    SECTION("tokenization error")
+    {
+        const auto serial = DfaTokenizer{descriptors};
+        const auto invalidText = std::string{"abc\ndef\nghi @\njkl\n"};
+
+        const auto parallel = ParallelTokenizer{serial, 4, 2};
+
+        REQUIRE_THROWS_AS(parallel.tokenize(invalidText), TokenizationError);
+
+        REQUIRE_THROWS_AS(serial.tokenize(invalidText), TokenizationError);
+
+        REQUIRE(getErrorMessage(parallel, invalidText) == getErrorMessage(ParallelTokenizer{serial, 1}, invalidText));
+    }
+
+    SECTION("foreign exceptions")
+    {
+        const auto serial = LineTokenizer{};
+        const auto parallel = ParallelTokenizer{serial, 4, 2};
+
+        REQUIRE(parallel.tokenize(text) == serial.tokenize(text));
+
+        REQUIRE_THROWS_AS(parallel.tokenize("abc\ndef\n@ghi\njkl\n"), int);
+    }
+
+    SECTION("empty text")
+    {
+        const auto serial = DfaTokenizer{descriptors};
+
+        REQUIRE(ParallelTokenizer{serial, 4, 1}.tokenize("").empty());
+    }
+
+    SECTION("invalid chunk size")
+    {
+        const auto serial = DfaTokenizer{descriptors};
+
+        REQUIRE_THROWS_AS((ParallelTokenizer{serial, 4, 0}), std::invalid_argument);
+    }
+}
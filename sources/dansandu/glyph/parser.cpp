@@ -1,47 +1,104 @@
 #include "dansandu/glyph/parser.hpp"
 #include "dansandu/glyph/internal/automaton.hpp"
+#include "dansandu/glyph/internal/compressed_parsing_table.hpp"
 #include "dansandu/glyph/internal/first_table.hpp"
 #include "dansandu/glyph/internal/grammar.hpp"
+#include "dansandu/glyph/internal/lalr.hpp"
+#include "dansandu/glyph/internal/lazy_parsing_table.hpp"
 #include "dansandu/glyph/internal/parsing.hpp"
 #include "dansandu/glyph/internal/parsing_table.hpp"
+#include "dansandu/glyph/mapped_file.hpp"
 #include "dansandu/glyph/node.hpp"
 #include "dansandu/glyph/symbol.hpp"
 #include "dansandu/glyph/token.hpp"
 
 #include <functional>
-#include <map>
 #include <memory>
 #include <ostream>
-#include <set>
+#include <string>
 #include <string_view>
 #include <vector>
 
 using dansandu::glyph::internal::automaton::Automaton;
 using dansandu::glyph::internal::automaton::getAutomaton;
+using dansandu::glyph::internal::automaton::getClosureTemplates;
+using dansandu::glyph::internal::automaton::getLr0Automaton;
+using dansandu::glyph::internal::automaton::getLr0StateClosure;
+using dansandu::glyph::internal::automaton::getMinimalLr1Automaton;
+using dansandu::glyph::internal::automaton::getStateClosure;
+using dansandu::glyph::internal::compressed_parsing_table::CompressedParsingTable;
+using dansandu::glyph::internal::compressed_parsing_table::getCompressedParsingTable;
+using dansandu::glyph::internal::compressed_parsing_table::getExpectedSymbols;
 using dansandu::glyph::internal::first_table::getFirstTable;
 using dansandu::glyph::internal::grammar::Grammar;
+using dansandu::glyph::internal::lalr::getLalr1Reductions;
+using dansandu::glyph::internal::lalr::Reduction;
+using dansandu::glyph::internal::lazy_parsing_table::LazyParsingTable;
 using dansandu::glyph::internal::parsing::parse;
-using dansandu::glyph::internal::parsing_table::Cell;
 using dansandu::glyph::internal::parsing_table::getClr1ParsingTable;
+using dansandu::glyph::internal::parsing_table::getDefaultReductions;
+using dansandu::glyph::internal::parsing_table::getLalr1ParsingTable;
+using dansandu::glyph::mapped_file::MappedFile;
 using dansandu::glyph::node::Node;
 using dansandu::glyph::symbol::Symbol;
 using dansandu::glyph::token::Token;
 using dansandu::glyph::tokenizer::ITokenizer;
+using dansandu::glyph::tokenizer::ITokenStream;
+using dansandu::glyph::tokenizer::TokenViewStream;
 
 namespace dansandu::glyph::parser
 {
 
+static Automaton getParserAutomaton(const Grammar& grammar, const ConstructionMode mode, const int threadsCount)
+{
+    switch (mode)
+    {
+    case ConstructionMode::lalr1:
+        return getLr0Automaton(grammar, threadsCount);
+    case ConstructionMode::minimalLr1:
+        return getMinimalLr1Automaton(grammar);
+    default:
+        return getAutomaton(grammar, threadsCount);
+    }
+}
+
+static CompressedParsingTable getParsingTable(const Grammar& grammar, const ConstructionMode mode,
+                                              const int threadsCount)
+{
+    if (mode == ConstructionMode::lazyClr1)
+    {
+        return getCompressedParsingTable({});
+    }
+    const auto automaton = getParserAutomaton(grammar, mode, threadsCount);
+    const auto parsingTable = mode == ConstructionMode::lalr1 ? getLalr1ParsingTable(grammar, automaton)
+                                                              : getClr1ParsingTable(grammar, automaton);
+    return getCompressedParsingTable(parsingTable, getDefaultReductions(parsingTable));
+}
+
 struct ParserImplementation
 {
-    ParserImplementation(const std::string_view grm)
-        : grammar{grm}, parsingTable{getClr1ParsingTable(grammar, getAutomaton(grammar))}
+    ParserImplementation(const std::string_view grm, const ConstructionMode mode, const int threadsCount)
+        : grammar{grm},
+          mode{mode},
+          parsingTable{getParsingTable(grammar, mode, threadsCount)},
+          expectedSymbols{getExpectedSymbols(grammar, parsingTable)},
+          lazyParsingTable{mode == ConstructionMode::lazyClr1 ? std::make_unique<LazyParsingTable>(grammar) : nullptr}
     {
     }
 
+    std::vector<Node> parse(const std::string_view text, ITokenStream& tokens) const
+    {
+        return lazyParsingTable ? ::parse(text, tokens, *lazyParsingTable, grammar)
+                                : ::parse(text, tokens, parsingTable, expectedSymbols, grammar);
+    }
+
     void print(std::ostream& stream) const;
 
     Grammar grammar;
-    std::vector<std::vector<Cell>> parsingTable;
+    ConstructionMode mode;
+    CompressedParsingTable parsingTable;
+    std::vector<std::vector<Symbol>> expectedSymbols;
+    std::unique_ptr<LazyParsingTable> lazyParsingTable;
 };
 
 void ParserImplementation::print(std::ostream& stream) const
@@ -74,31 +131,41 @@ void ParserImplementation::print(std::ostream& stream) const
 
     stream << "\nAutomaton:\n";
     stream << "  States:\n";
-    const auto automaton = getAutomaton(grammar);
-    for (auto i = 0; i < static_cast<int>(automaton.states.size()); ++i)
+    const auto automaton = getParserAutomaton(grammar, mode, 1);
+    const auto closureTemplates = getClosureTemplates(grammar, firstTable);
+    const auto reductions = mode == ConstructionMode::lalr1 ? getLalr1Reductions(grammar, automaton)
+                                                            : std::vector<std::vector<Reduction>>{};
+    for (auto i = 0; i < static_cast<int>(automaton.kernels.size()); ++i)
     {
-        const auto& state = automaton.states[i];
+        const auto state = mode == ConstructionMode::lalr1
+                               ? getLr0StateClosure(automaton.kernels[i], grammar)
+                               : getStateClosure(automaton.kernels[i], grammar, firstTable, closureTemplates);
         stream << "    State #" << i << ":\n";
-        auto collapsedItems = std::map<std::pair<int, int>, std::set<Symbol>>{};
-        for (const auto& item : state)
-        {
-            collapsedItems[{item.ruleIndex, item.position}].insert(item.lookahead);
-        }
-        for (const auto& entry : collapsedItems)
+        for (auto item : state)
         {
-            const auto& rule = grammar.getRules()[entry.first.first];
+            const auto& rule = grammar.getRules()[item.ruleIndex];
+            if (mode == ConstructionMode::lalr1 && item.position == static_cast<int>(rule.rightSide.size()))
+            {
+                for (const auto& reduction : reductions[i])
+                {
+                    if (reduction.ruleIndex == item.ruleIndex)
+                    {
+                        item.lookaheads |= reduction.lookaheads;
+                    }
+                }
+            }
             stream << "      " << grammar.getIdentifier(rule.leftSide) << " ->";
             for (auto j = 0; j < static_cast<int>(rule.rightSide.size()); ++j)
             {
                 const auto symbol = rule.rightSide[j];
-                stream << (entry.first.second == j ? " ." : " ") << grammar.getIdentifier(symbol);
+                stream << (item.position == j ? " ." : " ") << grammar.getIdentifier(symbol);
             }
-            if (entry.first.second == static_cast<int>(rule.rightSide.size()))
+            if (item.position == static_cast<int>(rule.rightSide.size()))
             {
                 stream << " .";
             }
-            stream << " ,";
-            for (const auto& lookahead : entry.second)
+            stream << (item.lookaheads.empty() ? "" : " ,");
+            for (const auto lookahead : item.lookaheads)
             {
                 stream << " " << grammar.getIdentifier(lookahead);
             }
@@ -118,7 +185,8 @@ static void deleter(const void* implementation)
     delete static_cast<const ParserImplementation*>(implementation);
 }
 
-Parser::Parser(const std::string_view grammar) : implementation_{new ParserImplementation{grammar}, &deleter}
+Parser::Parser(const std::string_view grammar, const ConstructionMode mode, const int threadsCount)
+    : implementation_{new ParserImplementation{grammar, mode, threadsCount}, &deleter}
 {
 }
 
@@ -134,8 +202,24 @@ Symbol Parser::getDiscardedSymbolPlaceholder() const
 
 std::vector<Node> Parser::parse(const std::string_view text, const ITokenizer& tokenizer) const
 {
-    const auto tokens = tokenizer.tokenize(text);
-    return ::parse(text, tokens, casted(implementation_.get())->parsingTable, casted(implementation_.get())->grammar);
+    const auto tokens = tokenizer.getTokenStream(text);
+    return casted(implementation_.get())->parse(text, *tokens);
+}
+
+std::vector<Node> Parser::parse(const std::string_view text, const ITokenizer& tokenizer,
+                                std::vector<Token>& tokenBuffer) const
+{
+    const auto implementation = casted(implementation_.get());
+    tokenBuffer.clear();
+    tokenizer.tokenize(text, tokenBuffer);
+    auto tokens = TokenViewStream{tokenBuffer};
+    return implementation->parse(text, tokens);
+}
+
+std::vector<Node> Parser::parseFile(const std::string& path, const ITokenizer& tokenizer) const
+{
+    const auto file = MappedFile{path};
+    return parse(file.getText(), tokenizer);
 }
 
 void Parser::print(std::ostream& stream) const
@@ -2,20 +2,39 @@
 
 #include "dansandu/glyph/node.hpp"
 #include "dansandu/glyph/symbol.hpp"
+#include "dansandu/glyph/token.hpp"
 #include "dansandu/glyph/tokenizer.hpp"
 
 #include <memory>
 #include <ostream>
+#include <string>
 #include <string_view>
 #include <vector>
 
 namespace dansandu::glyph::parser
 {
 
+// Canonical LR(1) tables accept every LR(1) grammar but can have many states for large grammars. LALR(1) tables have
+// as many states as the LR(0) automaton but reject the LR(1) grammars whose merged states have reduce/reduce conflicts.
+// Minimal LR(1) tables only merge the states that can be merged without conflicts, so they accept every LR(1) grammar
+// with about as many states as LALR(1) tables. Lazy canonical LR(1) tables are built while parsing, a state at a time
+// the first time a parse reaches it, so constructing the parser is cheap and only the reachable states are ever built.
+// Conflicts in the states along the start rule are reported by the constructor, the others once a parse reaches them.
+enum class ConstructionMode
+{
+    clr1,
+    lalr1,
+    minimalLr1,
+    lazyClr1
+};
+
 class PRALINE_EXPORT Parser
 {
 public:
-    explicit Parser(const std::string_view grammar);
+    // The canonical LR(1) and LR(0) automatons can be built on several threads, or on as many threads as the hardware
+    // supports if the count isn't positive. The table doesn't depend on the number of threads.
+    explicit Parser(const std::string_view grammar, const ConstructionMode mode = ConstructionMode::clr1,
+                    const int threadsCount = 1);
 
     dansandu::glyph::symbol::Symbol getTerminalSymbol(const std::string_view identifier) const;
 
@@ -24,6 +43,18 @@ public:
     std::vector<dansandu::glyph::node::Node> parse(const std::string_view text,
                                                    const dansandu::glyph::tokenizer::ITokenizer& tokenizer) const;
 
+    // Tokenizes the whole text into the buffer before parsing it. Reusing the buffer across calls avoids allocating
+    // tokens once it has grown large enough. Since the text is tokenized up front, context aware tokenization doesn't
+    // apply and the buffer holds the tokens of the text after the call.
+    std::vector<dansandu::glyph::node::Node> parse(const std::string_view text,
+                                                   const dansandu::glyph::tokenizer::ITokenizer& tokenizer,
+                                                   std::vector<dansandu::glyph::token::Token>& tokenBuffer) const;
+
+    // Parses the file through a read-only memory mapping instead of reading it into a string. The mapping is released
+    // once parsing is done, use MappedFile and parse directly if the token text is needed afterwards.
+    std::vector<dansandu::glyph::node::Node> parseFile(const std::string& path,
+                                                       const dansandu::glyph::tokenizer::ITokenizer& tokenizer) const;
+
     void print(std::ostream& stream) const;
 
 private:
@@ -1,22 +1,31 @@
 #include "dansandu/glyph/parser.hpp"
 #include "catchorg/catch/catch.hpp"
 #include "dansandu/ballotin/exception.hpp"
+#include "dansandu/glyph/dfa_tokenizer.hpp"
 #include "dansandu/glyph/error.hpp"
 #include "dansandu/glyph/node.hpp"
 #include "dansandu/glyph/regex_tokenizer.hpp"
 #include "dansandu/glyph/token.hpp"
 
 #include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <map>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 using Catch::Detail::Approx;
+using dansandu::glyph::dfa_tokenizer::DfaTokenizer;
 using dansandu::glyph::error::SyntaxError;
 using dansandu::glyph::node::Node;
+using dansandu::glyph::parser::ConstructionMode;
 using dansandu::glyph::parser::Parser;
 using dansandu::glyph::regex_tokenizer::RegexTokenizer;
+using dansandu::glyph::symbol::Symbol;
 using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::TokenizationMode;
 
 template<typename T>
 auto pop(std::vector<T>& stack)
@@ -30,7 +39,7 @@ auto pop(std::vector<T>& stack)
 class ArithmeticParser
 {
 public:
-    ArithmeticParser()
+    explicit ArithmeticParser(const ConstructionMode mode = ConstructionMode::clr1)
         : parser_{R"(
             /* 0*/ Start -> Sums
             /* 1*/ Sums  -> Sums plus Products
@@ -48,7 +57,7 @@ public:
             /*13*/ Value -> number
             /*14*/ Value -> identifier parenthesesStart Sums parenthesesEnd
             /*15*/ Value -> parenthesesStart Sums parenthesesEnd
-          )"},
+          )", mode},
           tokenizer_{{{parser_.getTerminalSymbol("plus"),             "\\+"},
                       {parser_.getTerminalSymbol("minus"),            "\\-"},
                       {parser_.getTerminalSymbol("multiply"),         "\\*"},
@@ -236,6 +245,264 @@ TEST_CASE("Parser")
         REQUIRE_THROWS_AS(parser.evaluate({}, {}, "50+"), SyntaxError);
     }
 
+    SECTION("LALR(1) construction")
+    {
+        const auto parser = ArithmeticParser{ConstructionMode::lalr1};
+
+        const auto variables = std::map<std::string, double>{{"x", 0.5}, {"y", 50.0}};
+
+        REQUIRE(parser.evaluate({{"cos", std::cos}}, variables, "(20 * -y - -x) / 2^3^2 + cos(0)") == Approx(-0.95214844));
+
+        REQUIRE_THROWS_AS(parser.evaluate({}, {}, "(50 + 30"), SyntaxError);
+
+        const auto grammar = R"(
+            Start -> S
+            S -> a E c
+            S -> a F d
+            S -> b F c
+            S -> b E d
+            E -> e
+            F -> e
+        )";
+
+        REQUIRE_NOTHROW(Parser{grammar});
+
+        REQUIRE_THROWS_AS(Parser(grammar, ConstructionMode::lalr1), std::logic_error);
+    }
+
+    SECTION("minimal LR(1) construction")
+    {
+        const auto parser = ArithmeticParser{ConstructionMode::minimalLr1};
+
+        const auto variables = std::map<std::string, double>{{"x", 0.5}, {"y", 50.0}};
+
+        REQUIRE(parser.evaluate({{"cos", std::cos}}, variables, "(20 * -y - -x) / 2^3^2 + cos(0)") == Approx(-0.95214844));
+
+        REQUIRE_THROWS_AS(parser.evaluate({}, {}, "50+"), SyntaxError);
+
+        const auto lr1Parser = Parser{R"(
+            /*0*/ Start -> S
+            /*1*/ S -> a E c
+            /*2*/ S -> a F d
+            /*3*/ S -> b F c
+            /*4*/ S -> b E d
+            /*5*/ E -> e
+            /*6*/ F -> e
+        )", ConstructionMode::minimalLr1};
+
+        const auto tokenizer = RegexTokenizer{{{lr1Parser.getTerminalSymbol("a"), "a"},
+                                               {lr1Parser.getTerminalSymbol("b"), "b"},
+                                               {lr1Parser.getTerminalSymbol("c"), "c"},
+                                               {lr1Parser.getTerminalSymbol("d"), "d"},
+                                               {lr1Parser.getTerminalSymbol("e"), "e"}}};
+
+        const auto nodes = lr1Parser.parse("bed", tokenizer);
+
+        REQUIRE(nodes.size() == 6);
+
+        REQUIRE(nodes[2].getRuleIndex() == 5);
+
+        REQUIRE(nodes[4].getRuleIndex() == 4);
+
+        REQUIRE_THROWS_AS(lr1Parser.parse("bee", tokenizer), SyntaxError);
+    }
+
+    SECTION("lazy construction")
+    {
+        const auto parser = ArithmeticParser{ConstructionMode::lazyClr1};
+
+        const auto variables = std::map<std::string, double>{{"x", 0.5}, {"y", 50.0}};
+
+        REQUIRE(parser.evaluate({{"cos", std::cos}}, variables, "(20 * -y - -x) / 2^3^2 + cos(0)") == Approx(-0.95214844));
+
+        REQUIRE(parser.evaluate({}, variables, "y - 2 * x") == Approx(49.0));
+
+        REQUIRE_THROWS_AS(parser.evaluate({}, {}, "(50 + 30"), SyntaxError);
+
+        const auto ambiguousParser = Parser{R"(
+            Start -> Sums
+            Sums  -> Sums plus Sums
+            Sums  -> number
+        )", ConstructionMode::lazyClr1};
+
+        const auto tokenizer = RegexTokenizer{{{ambiguousParser.getTerminalSymbol("number"), "\\d+"},
+                                               {ambiguousParser.getTerminalSymbol("plus"), "\\+"}}};
+
+        REQUIRE_THROWS_AS(ambiguousParser.parse("1+2+3", tokenizer), std::logic_error);
+
+        const auto conflictingGrammar = R"(
+            Start -> A b
+            A     ->
+            A     -> C
+            C     ->
+        )";
+
+        REQUIRE_THROWS_AS(Parser(conflictingGrammar, ConstructionMode::clr1), std::logic_error);
+
+        REQUIRE_THROWS_AS(Parser(conflictingGrammar, ConstructionMode::lazyClr1), std::logic_error);
+    }
+
+    SECTION("LALR(1) parser print")
+    {
+        const auto parser = Parser{R"(
+            Start -> Sums
+            Sums  -> Sums plus identifier
+            Sums  -> identifier
+        )", ConstructionMode::lalr1};
+
+        const auto expectedAutomaton =
+R"(Automaton:
+  States:
+    State #0:
+      Start -> .Sums
+      Sums -> .Sums plus identifier
+      Sums -> .identifier
+
+    State #1:
+      Start -> Sums .
+      Sums -> Sums .plus identifier
+
+    State #2:
+      Sums -> identifier . , $ plus
+
+    State #3:
+      Sums -> Sums plus .identifier
+
+    State #4:
+      Sums -> Sums plus identifier . , $ plus
+
+)";
+
+        auto stream = std::stringstream{};
+
+        parser.print(stream);
+
+        const auto print = stream.str();
+
+        REQUIRE(print.substr(print.find("Automaton:")) == expectedAutomaton);
+    }
+
+    SECTION("context aware tokenization")
+    {
+        const auto parser = Parser{R"(
+            /*0*/ Start -> Query
+            /*1*/ Query -> select identifier from identifier
+        )"};
+
+        const auto select     = parser.getTerminalSymbol("select");
+        const auto from       = parser.getTerminalSymbol("from");
+        const auto identifier = parser.getTerminalSymbol("identifier");
+        const auto whitespace = parser.getDiscardedSymbolPlaceholder();
+
+        const auto text = "select from from select";
+
+        const auto expected = std::vector<Node>{
+            Node{Token{select, 0, 6}},
+            Node{Token{identifier, 7, 11}},
+            Node{Token{from, 12, 16}},
+            Node{Token{identifier, 17, 23}},
+            Node{1},
+            Node{0}
+        };
+
+        const auto descriptors = std::vector<std::pair<Symbol, std::string_view>>{
+            {select,     "select"},
+            {from,       "from"},
+            {identifier, "[a-z]+"},
+            {whitespace, "\\s+"}
+        };
+
+        SECTION("regex tokenizer")
+        {
+            REQUIRE_THROWS_AS(parser.parse(text, RegexTokenizer{descriptors}), SyntaxError);
+
+            REQUIRE(parser.parse(text, RegexTokenizer{descriptors, TokenizationMode::contextAware}) == expected);
+
+            REQUIRE_THROWS_AS(parser.parse("select a b", RegexTokenizer{descriptors, TokenizationMode::contextAware}),
+                              SyntaxError);
+        }
+
+        SECTION("dfa tokenizer")
+        {
+            REQUIRE_THROWS_AS(parser.parse(text, DfaTokenizer{descriptors}), SyntaxError);
+
+            REQUIRE(parser.parse(text, DfaTokenizer{descriptors, TokenizationMode::contextAware}) == expected);
+
+            REQUIRE_THROWS_AS(parser.parse("select a b", DfaTokenizer{descriptors, TokenizationMode::contextAware}),
+                              SyntaxError);
+        }
+    }
+
+    SECTION("parse file")
+    {
+        const auto parser = Parser{R"(
+            Start -> Sums
+            Sums  -> Sums plus identifier
+            Sums  -> identifier
+        )"};
+
+        const auto plus       = parser.getTerminalSymbol("plus");
+        const auto identifier = parser.getTerminalSymbol("identifier");
+        const auto whitespace = parser.getDiscardedSymbolPlaceholder();
+
+        const auto tokenizer = DfaTokenizer{{
+            {plus,       "\\+"},
+            {identifier, "[a-z]+"},
+            {whitespace, "\\s+"}
+        }};
+
+        const auto path = (std::filesystem::temp_directory_path() / "glyph_parser_parse_file.txt").string();
+        std::ofstream{path, std::ios::binary} << "a +\nb";
+
+        const auto expected = std::vector<Node>{
+            Node{Token{identifier, 0, 1}},
+            Node{2},
+            Node{Token{plus, 2, 3}},
+            Node{Token{identifier, 4, 5}},
+            Node{1},
+            Node{0}
+        };
+
+        REQUIRE(parser.parseFile(path, tokenizer) == expected);
+
+        std::remove(path.c_str());
+
+        REQUIRE_THROWS_AS(parser.parseFile(path, tokenizer), std::runtime_error);
+    }
+
+    SECTION("token buffer")
+    {
+        const auto parser = Parser{R"(
+            Start -> Sums
+            Sums  -> Sums plus identifier
+            Sums  -> identifier
+        )"};
+
+        const auto plus       = parser.getTerminalSymbol("plus");
+        const auto identifier = parser.getTerminalSymbol("identifier");
+        const auto whitespace = parser.getDiscardedSymbolPlaceholder();
+
+        const auto tokenizer = DfaTokenizer{{
+            {plus,       "\\+"},
+            {identifier, "[a-z]+"},
+            {whitespace, "\\s+"}
+        }};
+
+        auto tokenBuffer = std::vector<Token>{};
+
+        REQUIRE(parser.parse("a + b + c", tokenizer, tokenBuffer) == parser.parse("a + b + c", tokenizer));
+
+        const auto capacity = tokenBuffer.capacity();
+
+        REQUIRE(parser.parse("x + y", tokenizer, tokenBuffer) == parser.parse("x + y", tokenizer));
+
+        REQUIRE(tokenBuffer.capacity() == capacity);
+
+        REQUIRE(tokenBuffer == tokenizer.tokenize("x + y"));
+
+        REQUIRE_THROWS_AS(parser.parse("x +", tokenizer, tokenBuffer), SyntaxError);
+    }
+
     SECTION("parser print")
     {
         const auto parser = Parser{R"(
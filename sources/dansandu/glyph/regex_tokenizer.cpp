@@ -1,59 +1,204 @@
 #include "dansandu/glyph/regex_tokenizer.hpp"
 #include "dansandu/ballotin/exception.hpp"
 #include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/internal/character_skipper.hpp"
+#include "dansandu/glyph/internal/literal_trie.hpp"
+#include "dansandu/glyph/internal/nfa.hpp"
 #include "dansandu/glyph/internal/text_location.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <regex>
 #include <string_view>
 #include <vector>
 
+using dansandu::glyph::error::PatternError;
 using dansandu::glyph::error::TokenizationError;
+using dansandu::glyph::internal::nfa::CharacterSet;
+using dansandu::glyph::internal::nfa::getFirstCharacters;
+using dansandu::glyph::internal::nfa::getLiteral;
+using dansandu::glyph::internal::nfa::getNfa;
+using dansandu::glyph::internal::nfa::Nfa;
 using dansandu::glyph::internal::text_location::getTextLocation;
 using dansandu::glyph::symbol::Symbol;
 using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::ITokenStream;
+using dansandu::glyph::tokenizer::TokenizationMode;
 
 namespace dansandu::glyph::regex_tokenizer
 {
 
-RegexTokenizer::RegexTokenizer(const std::vector<std::pair<Symbol, std::string_view>>& descriptors)
+class RegexTokenStream : public ITokenStream
+{
+public:
+    RegexTokenStream(const RegexTokenizer& tokenizer, const std::string_view text)
+        : tokenizer_{tokenizer}, text_{text}, position_{0}
+    {
+    }
+
+    std::optional<Token> nextToken() override
+    {
+        return matchNext(nullptr);
+    }
+
+    std::optional<Token> nextExpectedToken(const std::vector<Symbol>& expectedSymbols) override
+    {
+        return matchNext(&expectedSymbols);
+    }
+
+private:
+    std::optional<Token> matchNext(const std::vector<Symbol>* const expectedSymbols)
+    {
+        position_ = tokenizer_.skipper_.skip(text_, position_);
+        if (position_ == static_cast<std::int64_t>(text_.size()))
+        {
+            return std::nullopt;
+        }
+        const auto token = tokenizer_.matchToken(text_, position_, expectedSymbols);
+        position_ = token.end();
+        return token;
+    }
+
+    const RegexTokenizer& tokenizer_;
+    std::string_view text_;
+    std::int64_t position_;
+};
+
+static std::optional<Nfa> getDescriptorNfa(const std::string_view pattern)
+{
+    try
+    {
+        return getNfa(pattern);
+    }
+    catch (const PatternError&)
+    {
+        return std::nullopt;
+    }
+}
+
+RegexTokenizer::RegexTokenizer(const std::vector<std::pair<Symbol, std::string_view>>& descriptors,
+                               const TokenizationMode mode, const std::string_view skippedCharacters)
+    : mode_{mode}, skipper_{skippedCharacters}
 {
     descriptors_.reserve(descriptors.size());
-    for (const auto& descriptor : descriptors)
+    for (auto descriptorIndex = 0; descriptorIndex < static_cast<int>(descriptors.size()); ++descriptorIndex)
     {
+        const auto& descriptor = descriptors[descriptorIndex];
+        const auto nfa = getDescriptorNfa(descriptor.second);
+        if (const auto literal = nfa.has_value() ? getLiteral(nfa.value()) : std::nullopt;
+            literal.has_value() && !literal->empty())
+        {
+            descriptors_.push_back({descriptor.first, std::regex{}});
+            literals_.insert(literal.value(), descriptorIndex);
+            continue;
+        }
         descriptors_.push_back({descriptor.first, std::regex{descriptor.second.cbegin(), descriptor.second.cend()}});
+        const auto firstCharacters = nfa.has_value() ? getFirstCharacters(nfa.value()) : CharacterSet{}.set();
+        for (auto character = 0; character < static_cast<int>(candidates_.size()); ++character)
+        {
+            if (firstCharacters[character])
+            {
+                candidates_[character].push_back(descriptorIndex);
+            }
+        }
     }
 }
 
-std::vector<Token> RegexTokenizer::tokenize(const std::string_view text) const
+std::optional<Token> RegexTokenizer::matchDescriptors(const std::string_view text, const std::int64_t position,
+                                                      const std::vector<Symbol>* const expectedSymbols) const
 {
-    auto tokens = std::vector<Token>{};
-    auto position = text.cbegin();
-    auto match = std::match_results<decltype(position)>{};
+    const auto isExpected = [this, expectedSymbols](const int descriptorIndex)
+    {
+        return !expectedSymbols || std::binary_search(expectedSymbols->cbegin(), expectedSymbols->cend(),
+                                                      descriptors_[descriptorIndex].first);
+    };
+
+    auto literalIndex = -1;
+    auto literalLength = 0;
+    literals_.forEachMatch(text, position,
+                           [&literalIndex, &literalLength, &isExpected](const int descriptorIndex, const int length)
+                           {
+                               if ((literalIndex == -1 || descriptorIndex < literalIndex) &&
+                                   isExpected(descriptorIndex))
+                               {
+                                   literalIndex = descriptorIndex;
+                                   literalLength = length;
+                               }
+                           });
+
+    auto match = std::match_results<std::string_view::const_iterator>{};
     const auto flags = std::regex_constants::match_continuous;
-    while (position != text.cend())
+    for (const auto descriptorIndex : candidates_[static_cast<unsigned char>(text[position])])
     {
-        auto matchFound = false;
-        for (const auto& descriptor : descriptors_)
+        if (literalIndex != -1 && descriptorIndex > literalIndex)
         {
-            if (matchFound = std::regex_search(position, text.cend(), match, descriptor.second, flags); matchFound)
-            {
-                const auto begin = static_cast<int>(match[0].first - text.cbegin());
-                const auto end = static_cast<int>(match[0].second - text.cbegin());
-                tokens.push_back({descriptor.first, begin, end});
-                position += match.length();
-                break;
-            }
+            break;
+        }
+        if (!isExpected(descriptorIndex))
+        {
+            continue;
         }
-        if (!matchFound)
+        const auto& descriptor = descriptors_[descriptorIndex];
+        if (std::regex_search(text.cbegin() + position, text.cend(), match, descriptor.second, flags))
         {
-            const auto index = position - text.cbegin();
-            const auto textLocation = getTextLocation(text, index, index);
+            const auto begin = static_cast<std::int64_t>(match[0].first - text.cbegin());
+            const auto end = static_cast<std::int64_t>(match[0].second - text.cbegin());
+            return Token{descriptor.first, begin, end};
+        }
+    }
+
+    if (literalIndex != -1)
+    {
+        return Token{descriptors_[literalIndex].first, position, position + literalLength};
+    }
+    return std::nullopt;
+}
 
-            THROW(TokenizationError, "no pattern matches at line ", textLocation.lineNumber, " and column ",
-                  textLocation.columnNumber, "\n", textLocation.highlight);
+Token RegexTokenizer::matchToken(const std::string_view text, const std::int64_t position,
+                                 const std::vector<Symbol>* const expectedSymbols) const
+{
+    if (expectedSymbols && mode_ == TokenizationMode::contextAware)
+    {
+        if (const auto token = matchDescriptors(text, position, expectedSymbols); token.has_value())
+        {
+            return token.value();
         }
     }
+
+    if (const auto token = matchDescriptors(text, position, nullptr); token.has_value())
+    {
+        return token.value();
+    }
+
+    const auto textLocation = getTextLocation(text, position, position);
+
+    THROW(TokenizationError, "no pattern matches at line ", textLocation.lineNumber, " and column ",
+          textLocation.columnNumber, "\n", textLocation.highlight);
+}
+
+std::vector<Token> RegexTokenizer::tokenize(const std::string_view text) const
+{
+    auto tokens = std::vector<Token>{};
+    tokenize(text, tokens);
     return tokens;
 }
 
+void RegexTokenizer::tokenize(const std::string_view text, std::vector<Token>& tokens) const
+{
+    auto position = skipper_.skip(text, 0);
+    while (position != static_cast<std::int64_t>(text.size()))
+    {
+        const auto token = matchToken(text, position, nullptr);
+        tokens.push_back(token);
+        position = skipper_.skip(text, token.end());
+    }
+}
+
+std::unique_ptr<ITokenStream> RegexTokenizer::getTokenStream(const std::string_view text) const
+{
+    return std::make_unique<RegexTokenStream>(*this, text);
+}
+
 }
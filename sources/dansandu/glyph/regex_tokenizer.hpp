@@ -1,8 +1,14 @@
 #pragma once
 
+#include "dansandu/glyph/internal/character_skipper.hpp"
+#include "dansandu/glyph/internal/literal_trie.hpp"
 #include "dansandu/glyph/symbol.hpp"
 #include "dansandu/glyph/tokenizer.hpp"
 
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <regex>
 #include <string_view>
 #include <vector>
@@ -10,16 +16,42 @@
 namespace dansandu::glyph::regex_tokenizer
 {
 
+// Descriptors are only tried at positions whose first byte can start one of their matches. Patterns that cannot be
+// analyzed are tried at every position. Patterns matching a single fixed string, such as keywords and punctuation, are
+// looked up in a trie instead of going through std::regex. Runs of skipped characters, typically whitespace, are
+// jumped over with vectorized scans before each token and never produce tokens, so no token can start with them.
 class PRALINE_EXPORT RegexTokenizer : public dansandu::glyph::tokenizer::ITokenizer
 {
+    friend class RegexTokenStream;
+
 public:
     explicit RegexTokenizer(
-        const std::vector<std::pair<dansandu::glyph::symbol::Symbol, std::string_view>>& descriptors);
+        const std::vector<std::pair<dansandu::glyph::symbol::Symbol, std::string_view>>& descriptors,
+        const dansandu::glyph::tokenizer::TokenizationMode mode =
+            dansandu::glyph::tokenizer::TokenizationMode::contextFree,
+        const std::string_view skippedCharacters = {});
 
     std::vector<dansandu::glyph::token::Token> tokenize(const std::string_view text) const override;
 
+    void tokenize(const std::string_view text, std::vector<dansandu::glyph::token::Token>& tokens) const override;
+
+    std::unique_ptr<dansandu::glyph::tokenizer::ITokenStream>
+    getTokenStream(const std::string_view text) const override;
+
 private:
+    std::optional<dansandu::glyph::token::Token>
+    matchDescriptors(const std::string_view text, const std::int64_t position,
+                     const std::vector<dansandu::glyph::symbol::Symbol>* const expectedSymbols) const;
+
+    dansandu::glyph::token::Token
+    matchToken(const std::string_view text, const std::int64_t position,
+               const std::vector<dansandu::glyph::symbol::Symbol>* const expectedSymbols) const;
+
     std::vector<std::pair<dansandu::glyph::symbol::Symbol, std::regex>> descriptors_;
+    dansandu::glyph::internal::literal_trie::LiteralTrie literals_;
+    std::array<std::vector<int>, 256> candidates_;
+    dansandu::glyph::tokenizer::TokenizationMode mode_;
+    dansandu::glyph::internal::character_skipper::CharacterSkipper skipper_;
 };
 
 }
@@ -7,6 +7,7 @@ using dansandu::glyph::error::TokenizationError;
 using dansandu::glyph::regex_tokenizer::RegexTokenizer;
 using dansandu::glyph::symbol::Symbol;
 using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::TokenizationMode;
 
 TEST_CASE("RegexTokenizer")
 {
@@ -41,4 +42,78 @@ TEST_CASE("RegexTokenizer")
 
         REQUIRE_THROWS_AS(tokenizer.tokenize("@a + 10"), TokenizationError);
     }
+
+    SECTION("patterns without first byte analysis")
+    {
+        const auto lookahead = RegexTokenizer{{{number, "\\d+"}, {identifier, "(?=[a-z])\\w+"}, {whitespace, "\\s+"}}};
+
+        REQUIRE(lookahead.tokenize("abc 12 x1") == std::vector<Token>{{identifier, 0, 3},
+                                                                       {whitespace, 3, 4},
+                                                                       {number, 4, 6},
+                                                                       {whitespace, 6, 7},
+                                                                       {identifier, 7, 9}});
+
+        REQUIRE_THROWS_AS(lookahead.tokenize("_a"), TokenizationError);
+    }
+
+    SECTION("literal descriptors")
+    {
+        const auto keyword = Symbol{4};
+        const auto increment = Symbol{5};
+
+        const auto keywordFirst = RegexTokenizer{
+            {{keyword, "select"}, {identifier, "[a-z]+"}, {add, "\\+"}, {increment, "\\+\\+"}, {whitespace, " +"}}};
+
+        REQUIRE(keywordFirst.tokenize("select selection ++") == std::vector<Token>{{keyword, 0, 6},
+                                                                                   {whitespace, 6, 7},
+                                                                                   {keyword, 7, 13},
+                                                                                   {identifier, 13, 16},
+                                                                                   {whitespace, 16, 17},
+                                                                                   {add, 17, 18},
+                                                                                   {add, 18, 19}});
+
+        const auto identifierFirst = RegexTokenizer{
+            {{identifier, "[a-z]+"}, {keyword, "select"}, {increment, "\\+\\+"}, {add, "\\+"}, {whitespace, " +"}}};
+
+        REQUIRE(identifierFirst.tokenize("select ++") ==
+                std::vector<Token>{{identifier, 0, 6}, {whitespace, 6, 7}, {increment, 7, 9}});
+    }
+
+    SECTION("skipped characters")
+    {
+        const auto skipping =
+            RegexTokenizer{{{identifier, "[a-zA-Z]\\w*"}, {number, "([1-9]\\d*|0)(\\.\\d+)?"}, {add, "\\+"}},
+                           TokenizationMode::contextFree, " \t\n"};
+
+        const auto text = "  a +\n\t                   10 ";
+
+        REQUIRE(skipping.tokenize(text) == std::vector<Token>{{identifier, 2, 3}, {add, 4, 5}, {number, 26, 28}});
+
+        const auto stream = skipping.getTokenStream(text);
+
+        REQUIRE(stream->nextToken() == Token{identifier, 2, 3});
+
+        REQUIRE(stream->nextToken() == Token{add, 4, 5});
+
+        REQUIRE(stream->nextToken() == Token{number, 26, 28});
+
+        REQUIRE(!stream->nextToken().has_value());
+
+        REQUIRE(skipping.tokenize("   ").empty());
+    }
+
+    SECTION("token stream is lazy")
+    {
+        const auto stream = tokenizer.getTokenStream("a + &");
+
+        REQUIRE(stream->nextToken() == Token{identifier, 0, 1});
+
+        REQUIRE(stream->nextToken() == Token{whitespace, 1, 2});
+
+        REQUIRE(stream->nextToken() == Token{add, 2, 3});
+
+        REQUIRE(stream->nextToken() == Token{whitespace, 3, 4});
+
+        REQUIRE_THROWS_AS(stream->nextToken(), TokenizationError);
+    }
 }
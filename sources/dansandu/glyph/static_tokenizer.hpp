@@ -0,0 +1,122 @@
+#pragma once
+
+#include "dansandu/ballotin/exception.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/internal/character_skipper.hpp"
+#include "dansandu/glyph/internal/dfa.hpp"
+#include "dansandu/glyph/internal/static_automaton.hpp"
+#include "dansandu/glyph/internal/text_location.hpp"
+#include "dansandu/glyph/symbol.hpp"
+#include "dansandu/glyph/token.hpp"
+#include "dansandu/glyph/tokenizer.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dansandu::glyph::static_tokenizer
+{
+
+// Tokenizer whose patterns are a constant array, for example a constexpr std::string_view array at namespace scope,
+// given as template argument. The deterministic automaton is built at compile time with the same matching rules as the
+// DfaTokenizer, so constructing the tokenizer doesn't compile anything and matching never allocates. The symbols are
+// passed to the constructor in the order of the patterns since they are only known once the parser is built. Context
+// aware tokenization isn't supported. The capacity bounds the number of automaton states and compilation fails if it is
+// exceeded. Malformed patterns fail to compile as well.
+template<const auto& Patterns, int Capacity = 512>
+class StaticTokenizer : public dansandu::glyph::tokenizer::ITokenizer
+{
+public:
+    using Automaton = dansandu::glyph::internal::static_automaton::StaticAutomaton<Patterns, Capacity>;
+
+    static constexpr auto patternsCount = Automaton::patternsCount;
+
+    explicit StaticTokenizer(const std::array<dansandu::glyph::symbol::Symbol, patternsCount>& symbols,
+                             const std::string_view skippedCharacters = {})
+        : symbols_{symbols}, skipper_{skippedCharacters}
+    {
+    }
+
+    // Yields the index of the pattern matched at the given position and the end of the match, or -1 and the position if
+    // no pattern matches.
+    static constexpr std::pair<int, std::int64_t> matchPattern(const std::string_view text,
+                                                               const std::int64_t position)
+    {
+        return dansandu::glyph::internal::dfa::matchLongestPattern(Automaton::dfa, Automaton::classes.classesCount, text,
+                                                                   position);
+    }
+
+    std::vector<dansandu::glyph::token::Token> tokenize(const std::string_view text) const override
+    {
+        auto tokens = std::vector<dansandu::glyph::token::Token>{};
+        tokenize(text, tokens);
+        return tokens;
+    }
+
+    void tokenize(const std::string_view text, std::vector<dansandu::glyph::token::Token>& tokens) const override
+    {
+        auto position = skipper_.skip(text, 0);
+        while (position != static_cast<std::int64_t>(text.size()))
+        {
+            const auto token = matchToken(text, position);
+            tokens.push_back(token);
+            position = skipper_.skip(text, token.end());
+        }
+    }
+
+    std::unique_ptr<dansandu::glyph::tokenizer::ITokenStream>
+    getTokenStream(const std::string_view text) const override
+    {
+        return std::make_unique<StaticTokenStream>(*this, text);
+    }
+
+private:
+    class StaticTokenStream : public dansandu::glyph::tokenizer::ITokenStream
+    {
+    public:
+        StaticTokenStream(const StaticTokenizer& tokenizer, const std::string_view text)
+            : tokenizer_{tokenizer}, text_{text}, position_{0}
+        {
+        }
+
+        std::optional<dansandu::glyph::token::Token> nextToken() override
+        {
+            position_ = tokenizer_.skipper_.skip(text_, position_);
+            if (position_ == static_cast<std::int64_t>(text_.size()))
+            {
+                return std::nullopt;
+            }
+            const auto token = tokenizer_.matchToken(text_, position_);
+            position_ = token.end();
+            return token;
+        }
+
+    private:
+        const StaticTokenizer& tokenizer_;
+        std::string_view text_;
+        std::int64_t position_;
+    };
+
+    dansandu::glyph::token::Token matchToken(const std::string_view text, const std::int64_t position) const
+    {
+        const auto [pattern, end] = matchPattern(text, position);
+        if (pattern != -1)
+        {
+            return dansandu::glyph::token::Token{symbols_[pattern], position, end};
+        }
+
+        const auto textLocation = dansandu::glyph::internal::text_location::getTextLocation(text, position, position);
+
+        THROW(dansandu::glyph::error::TokenizationError, "no pattern matches at line ", textLocation.lineNumber,
+              " and column ", textLocation.columnNumber, "\n", textLocation.highlight);
+    }
+
+    std::array<dansandu::glyph::symbol::Symbol, patternsCount> symbols_;
+    dansandu::glyph::internal::character_skipper::CharacterSkipper skipper_;
+};
+
+}
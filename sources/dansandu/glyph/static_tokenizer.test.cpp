@@ -0,0 +1,93 @@
+#include "dansandu/glyph/static_tokenizer.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/glyph/dfa_tokenizer.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/token.hpp"
+
+#include <array>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using dansandu::glyph::dfa_tokenizer::DfaTokenizer;
+using dansandu::glyph::error::TokenizationError;
+using dansandu::glyph::static_tokenizer::StaticTokenizer;
+using dansandu::glyph::symbol::Symbol;
+using dansandu::glyph::token::Token;
+
+static constexpr std::string_view patterns[] = {
+    "if",
+    "[a-z_]\\w*",
+    "(?:0|[1-9]\\d*)(?:\\.\\d+)?(?:[eE][+\\-]?\\d{1,3})?",
+    "\"(?:[^\"\\\\\\n]|\\\\.)*\"",
+    "\\+|-|\\*|/|==?",
+    "\\s+"
+};
+
+using Tokenizer = StaticTokenizer<patterns>;
+
+static_assert(Tokenizer::matchPattern("if", 0) == std::pair<int, std::int64_t>{0, 2});
+
+static_assert(Tokenizer::matchPattern("iffy", 0) == std::pair<int, std::int64_t>{0, 2});
+
+static_assert(Tokenizer::matchPattern("fifty", 0) == std::pair<int, std::int64_t>{1, 5});
+
+static_assert(Tokenizer::matchPattern("12.5e+10 ", 0) == std::pair<int, std::int64_t>{2, 8});
+
+static_assert(Tokenizer::matchPattern("a == b", 2) == std::pair<int, std::int64_t>{4, 4});
+
+static_assert(Tokenizer::matchPattern("@", 0) == std::pair<int, std::int64_t>{-1, 0});
+
+TEST_CASE("StaticTokenizer")
+{
+    const auto symbols = std::array<Symbol, Tokenizer::patternsCount>{Symbol{2}, Symbol{3}, Symbol{4},
+                                                                      Symbol{5}, Symbol{6}, Symbol{7}};
+
+    const auto descriptors = std::vector<std::pair<Symbol, std::string_view>>{
+        {symbols[0], patterns[0]},
+        {symbols[1], patterns[1]},
+        {symbols[2], patterns[2]},
+        {symbols[3], patterns[3]},
+        {symbols[4], patterns[4]},
+        {symbols[5], patterns[5]}
+    };
+
+    const auto tokenizer = Tokenizer{symbols};
+
+    SECTION("same tokens as the dfa tokenizer")
+    {
+        const auto dfaTokenizer = DfaTokenizer{descriptors};
+
+        const auto text = std::string_view{"if iffy == 12.5e+10 * _x1 / \"a \\\" b\" - 0"};
+
+        REQUIRE(tokenizer.tokenize(text) == dfaTokenizer.tokenize(text));
+
+        REQUIRE(tokenizer.tokenize(text).size() == 20);
+    }
+
+    SECTION("token stream")
+    {
+        const auto stream = tokenizer.getTokenStream("x=1");
+
+        REQUIRE(stream->nextToken() == Token{symbols[1], 0, 1});
+
+        REQUIRE(stream->nextToken() == Token{symbols[4], 1, 2});
+
+        REQUIRE(stream->nextToken() == Token{symbols[2], 2, 3});
+
+        REQUIRE(!stream->nextToken().has_value());
+    }
+
+    SECTION("skipped characters")
+    {
+        const auto skipping = Tokenizer{symbols, " "};
+
+        REQUIRE(skipping.tokenize("  a + b ") == std::vector<Token>{{symbols[1], 2, 3}, {symbols[4], 4, 5},
+                                                                     {symbols[1], 6, 7}});
+    }
+
+    SECTION("tokenization error")
+    {
+        REQUIRE_THROWS_AS(tokenizer.tokenize("a @ b"), TokenizationError);
+    }
+}
@@ -2,6 +2,7 @@
 
 #include "dansandu/glyph/symbol.hpp"
 
+#include <cstdint>
 #include <ostream>
 
 namespace dansandu::glyph::token
@@ -10,7 +11,7 @@ namespace dansandu::glyph::token
 class PRALINE_EXPORT Token
 {
 public:
-    Token(const dansandu::glyph::symbol::Symbol symbol, const int begin, const int end)
+    Token(const dansandu::glyph::symbol::Symbol symbol, const std::int64_t begin, const std::int64_t end)
         : symbol_{symbol}, begin_{begin}, end_{end}
     {
     }
@@ -20,20 +21,20 @@ public:
         return symbol_;
     }
 
-    int begin() const
+    std::int64_t begin() const
     {
         return begin_;
     }
 
-    int end() const
+    std::int64_t end() const
     {
         return end_;
     }
 
 private:
     dansandu::glyph::symbol::Symbol symbol_;
-    int begin_;
-    int end_;
+    std::int64_t begin_;
+    std::int64_t end_;
 };
 
 inline bool operator==(const Token& left, const Token& right)
@@ -1,12 +1,66 @@
 #include "dansandu/glyph/tokenizer.hpp"
 
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+using dansandu::glyph::symbol::Symbol;
+using dansandu::glyph::token::Token;
+
 namespace dansandu::glyph::tokenizer
 {
 
+ITokenStream::ITokenStream()
+{
+}
+
+std::optional<Token> ITokenStream::nextExpectedToken(const std::vector<Symbol>&)
+{
+    return nextToken();
+}
+
+ITokenStream::~ITokenStream() noexcept
+{
+}
+
+TokenViewStream::TokenViewStream(const std::vector<Token>& tokens) : tokens_{tokens}, position_{0}
+{
+}
+
+std::optional<Token> TokenViewStream::nextToken()
+{
+    if (position_ < tokens_.size())
+    {
+        return tokens_[position_++];
+    }
+    return std::nullopt;
+}
+
+TokenVectorStream::TokenVectorStream(std::vector<Token> tokens) : tokens_{std::move(tokens)}, view_{tokens_}
+{
+}
+
+std::optional<Token> TokenVectorStream::nextToken()
+{
+    return view_.nextToken();
+}
+
 ITokenizer::ITokenizer()
 {
 }
 
+void ITokenizer::tokenize(const std::string_view text, std::vector<Token>& tokens) const
+{
+    const auto produced = tokenize(text);
+    tokens.insert(tokens.end(), produced.cbegin(), produced.cend());
+}
+
+std::unique_ptr<ITokenStream> ITokenizer::getTokenStream(const std::string_view text) const
+{
+    return std::make_unique<TokenVectorStream>(tokenize(text));
+}
+
 ITokenizer::~ITokenizer() noexcept
 {
 }
@@ -1,19 +1,84 @@
 #pragma once
 
 #include "dansandu/ballotin/type_traits.hpp"
+#include "dansandu/glyph/symbol.hpp"
 #include "dansandu/glyph/token.hpp"
 
+#include <memory>
+#include <optional>
+#include <string_view>
 #include <vector>
 
 namespace dansandu::glyph::tokenizer
 {
 
+// In context aware mode tokenizers only try the descriptors of the symbols the parser can shift next, which also
+// resolves overlapping patterns such as keywords and identifiers. If none of them matches, all descriptors are tried so
+// that the parser can report the unexpected token.
+enum class TokenizationMode
+{
+    contextFree,
+    contextAware
+};
+
+class PRALINE_EXPORT ITokenStream : private dansandu::ballotin::type_traits::Uncopyable,
+                                    private dansandu::ballotin::type_traits::Immovable
+{
+public:
+    ITokenStream();
+    virtual std::optional<dansandu::glyph::token::Token> nextToken() = 0;
+
+    // Yields the next token knowing the sorted symbols the parser can shift next, including the discarded symbol
+    // placeholder. Streams that ignore the context yield the same token as nextToken.
+    virtual std::optional<dansandu::glyph::token::Token>
+    nextExpectedToken(const std::vector<dansandu::glyph::symbol::Symbol>& expectedSymbols);
+
+    virtual ~ITokenStream() noexcept;
+};
+
+// Streams tokens from a vector it doesn't own, which must outlive the stream.
+class PRALINE_EXPORT TokenViewStream : public ITokenStream
+{
+public:
+    explicit TokenViewStream(const std::vector<dansandu::glyph::token::Token>& tokens);
+
+    std::optional<dansandu::glyph::token::Token> nextToken() override;
+
+private:
+    const std::vector<dansandu::glyph::token::Token>& tokens_;
+    size_t position_;
+};
+
+// Streams tokens from a vector it owns by delegating to a view of it.
+class PRALINE_EXPORT TokenVectorStream : public ITokenStream
+{
+public:
+    explicit TokenVectorStream(std::vector<dansandu::glyph::token::Token> tokens);
+
+    std::optional<dansandu::glyph::token::Token> nextToken() override;
+
+private:
+    std::vector<dansandu::glyph::token::Token> tokens_;
+    TokenViewStream view_;
+};
+
 class PRALINE_EXPORT ITokenizer : private dansandu::ballotin::type_traits::Uncopyable,
                                   private dansandu::ballotin::type_traits::Immovable
 {
 public:
     ITokenizer();
     virtual std::vector<dansandu::glyph::token::Token> tokenize(const std::string_view text) const = 0;
+
+    // Appends the tokens of the text to the buffer, which callers can reuse across texts. With the DfaTokenizer and the
+    // StaticTokenizer tokenizing then doesn't allocate once the buffer has grown large enough, whereas the
+    // RegexTokenizer allocates while matching and the ParallelTokenizer for its chunks. The default implementation
+    // appends the result of tokenize.
+    virtual void tokenize(const std::string_view text, std::vector<dansandu::glyph::token::Token>& tokens) const;
+
+    // Yields the tokens of the text one at a time. Tokenizers that can match lazily should override it since the
+    // default implementation tokenizes the whole text up front.
+    virtual std::unique_ptr<ITokenStream> getTokenStream(const std::string_view text) const;
+
     virtual ~ITokenizer() noexcept;
 };
 
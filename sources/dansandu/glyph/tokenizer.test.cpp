@@ -0,0 +1,90 @@
+#include "dansandu/glyph/tokenizer.hpp"
+#include "catchorg/catch/catch.hpp"
+#include "dansandu/ballotin/exception.hpp"
+#include "dansandu/glyph/error.hpp"
+#include "dansandu/glyph/symbol.hpp"
+#include "dansandu/glyph/token.hpp"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+using dansandu::glyph::error::TokenizationError;
+using dansandu::glyph::symbol::Symbol;
+using dansandu::glyph::token::Token;
+using dansandu::glyph::tokenizer::ITokenizer;
+using dansandu::glyph::tokenizer::TokenVectorStream;
+using dansandu::glyph::tokenizer::TokenViewStream;
+
+// Yields a token for each character and relies on the default implementations of the other methods.
+class CharacterTokenizer : public ITokenizer
+{
+public:
+    using ITokenizer::tokenize;
+
+    std::vector<Token> tokenize(const std::string_view text) const override
+    {
+        auto tokens = std::vector<Token>{};
+        for (auto position = std::int64_t{0}; position < static_cast<std::int64_t>(text.size()); ++position)
+        {
+            if (text[position] == '@')
+            {
+                THROW(TokenizationError, "unrecognized character at position ", position);
+            }
+            tokens.push_back({Symbol{static_cast<unsigned char>(text[position])}, position, position + 1});
+        }
+        return tokens;
+    }
+};
+
+TEST_CASE("Tokenizer")
+{
+    const auto tokenizer = CharacterTokenizer{};
+
+    const auto a = Symbol{'a'};
+    const auto b = Symbol{'b'};
+
+    SECTION("token buffer")
+    {
+        auto tokens = std::vector<Token>{Token{b, 0, 1}};
+
+        tokenizer.tokenize("ab", tokens);
+
+        REQUIRE(tokens == std::vector<Token>{{b, 0, 1}, {a, 0, 1}, {b, 1, 2}});
+    }
+
+    SECTION("token stream")
+    {
+        const auto stream = tokenizer.getTokenStream("ab");
+
+        REQUIRE(stream->nextToken() == Token{a, 0, 1});
+
+        REQUIRE(stream->nextExpectedToken({b}) == Token{b, 1, 2});
+
+        REQUIRE(!stream->nextToken().has_value());
+    }
+
+    SECTION("token stream is eager")
+    {
+        REQUIRE_THROWS_AS(tokenizer.getTokenStream("a@"), TokenizationError);
+    }
+
+    SECTION("vector streams")
+    {
+        const auto tokens = std::vector<Token>{{a, 0, 1}, {b, 1, 2}};
+
+        auto view = TokenViewStream{tokens};
+        auto owner = TokenVectorStream{tokens};
+
+        for (const auto& token : tokens)
+        {
+            REQUIRE(view.nextToken() == token);
+
+            REQUIRE(owner.nextToken() == token);
+        }
+
+        REQUIRE(!view.nextToken().has_value());
+
+        REQUIRE(!owner.nextToken().has_value());
+    }
+}